@@ -149,53 +149,140 @@ void zephir_is_basic_charset(zval *return_value, const zval *param){
 	RETURN_STRING("ISO-8859-1", 1);
 }
 
-static long zephir_unpack(char *data, int size, int issigned, int *map)
-{
-	long result;
-	char *cresult = (char *) &result;
-	int i;
+/**
+ * Characters the escaping functions leave as they are: 1 = alphanumeric, 2 = JS/HTML attribute whitelist
+ */
+static const unsigned char zephir_escape_map[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 2, 0, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 0, 0, 0, 2,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2,
+	0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+#define ZEPHIR_ESCAPE_ALNUM     1
+#define ZEPHIR_ESCAPE_WHITELIST 3
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ZEPHIR_ESCAPE_BLOCK 32
+
+/**
+ * Checks if the 32 bytes of a block are ASCII alphanumeric characters
+ */
+static inline int zephir_escape_alnum_block(const unsigned char *str) {
+
+	__m256i chunk = _mm256_loadu_si256((const __m256i *) str), zero = _mm256_setzero_si256(), digit, alpha;
+
+	/* c is in [lo, lo + n] when the saturated (c - lo) - n is zero */
+	digit = _mm256_cmpeq_epi8(_mm256_subs_epu8(_mm256_sub_epi8(chunk, _mm256_set1_epi8('0')), _mm256_set1_epi8(9)), zero);
+	chunk = _mm256_or_si256(chunk, _mm256_set1_epi8(0x20));
+	alpha = _mm256_cmpeq_epi8(_mm256_subs_epu8(_mm256_sub_epi8(chunk, _mm256_set1_epi8('a')), _mm256_set1_epi8(25)), zero);
+
+	return _mm256_movemask_epi8(_mm256_or_si256(digit, alpha)) == -1;
+}
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define ZEPHIR_ESCAPE_BLOCK 16
+
+/**
+ * Checks if the 16 bytes of a block are ASCII alphanumeric characters
+ */
+static inline int zephir_escape_alnum_block(const unsigned char *str) {
 
-	result = issigned ? -1 : 0;
+	__m128i chunk = _mm_loadu_si128((const __m128i *) str), zero = _mm_setzero_si128(), digit, alpha;
+
+	/* c is in [lo, lo + n] when the saturated (c - lo) - n is zero */
+	digit = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(chunk, _mm_set1_epi8('0')), _mm_set1_epi8(9)), zero);
+	chunk = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+	alpha = _mm_cmpeq_epi8(_mm_subs_epu8(_mm_sub_epi8(chunk, _mm_set1_epi8('a')), _mm_set1_epi8(25)), zero);
+
+	return _mm_movemask_epi8(_mm_or_si128(digit, alpha)) == 0xFFFF;
+}
+#endif
+
+/**
+ * Returns the length of the initial run of characters that don't need to be escaped.
+ * Blocks of alphanumeric characters are skipped with SIMD instructions when available,
+ * the other blocks are checked one byte at a time
+ */
+static size_t zephir_escape_safe_span(const unsigned char *str, size_t length, unsigned char mask) {
+
+	size_t i = 0, end;
+
+	while (i < length) {
+
+#ifdef ZEPHIR_ESCAPE_BLOCK
+		while (i + ZEPHIR_ESCAPE_BLOCK <= length && zephir_escape_alnum_block(str + i)) {
+			i += ZEPHIR_ESCAPE_BLOCK;
+		}
+		end = i + ZEPHIR_ESCAPE_BLOCK <= length ? i + ZEPHIR_ESCAPE_BLOCK : length;
+#else
+		end = length;
+#endif
 
-	for (i = 0; i < size; i++) {
-		cresult[map[i]] = *data++;
+		for (; i < end; i++) {
+			if (!(zephir_escape_map[str[i]] & mask)) {
+				return i;
+			}
+		}
 	}
 
-	return result;
+	return i;
 }
 
 /**
- * Converts an unsigned long to a char*
+ * Writes an escaped character returning the number of bytes written
  */
-static inline char *zephir_longtohex(unsigned long value) {
+static inline size_t zephir_escape_char(char *dest, unsigned long value, const char *escape_char, unsigned int escape_length, char escape_extra) {
 
-	static char digits[] = "0123456789abcdef";
-	char buf[(sizeof(unsigned long) << 3) + 1];
-	char *ptr, *end;
+	static const char digits[] = "0123456789abcdef";
+	char hex[sizeof(unsigned long) << 1];
+	size_t length = 0, hex_length = 0;
 
-	end = ptr = buf + sizeof(buf) - 1;
-	*ptr = '\0';
 	do {
-		*--ptr = digits[value & 0x0F];
+		hex[hex_length++] = digits[value & 0x0F];
 		value >>= 4;
-	} while (ptr > buf && value);
+	} while (value);
+
+	memcpy(dest, escape_char, escape_length);
+	length = escape_length;
+
+	while (hex_length) {
+		dest[length++] = hex[--hex_length];
+	}
+
+	if (escape_extra != '\0') {
+		dest[length++] = escape_extra;
+	}
 
-	return estrndup(ptr, end - ptr);
+	return length;
 }
 
 /**
  * Perform escaping of non-alphanumeric characters to different formats
+ * The input must be a valid UTF-32 (big endian) string
  */
 void zephir_escape_multi(zval *return_value, zval *param, const char *escape_char, unsigned int escape_length, char escape_extra, int use_whitelist) {
 
-	unsigned int i;
+	size_t i, length, escaped_length = 0;
 	zval copy;
-	smart_str escaped_str = {0};
-	char machine_little_endian, *hex;
-	int big_endian_long_map[4];
-	int use_copy = 0, machine_endian_check = 1;
-	int issigned = 0;
-	long value;
+	const unsigned char *str;
+	char *escaped;
+	int use_copy = 0;
+	unsigned char mask = use_whitelist ? ZEPHIR_ESCAPE_WHITELIST : ZEPHIR_ESCAPE_ALNUM;
+	unsigned long value;
 
 	if (Z_TYPE_P(param) != IS_STRING) {
 		zend_make_printable_zval(param, &copy, &use_copy);
@@ -204,127 +291,120 @@ void zephir_escape_multi(zval *return_value, zval *param, const char *escape_cha
 		}
 	}
 
-	if (Z_STRLEN_P(param) <= 0) {
-		RETURN_FALSE;
-	}
-
-	/**
-	 * This is how the big_ending_long_map is calculated as in 'pack'
-	 */
-	machine_little_endian = ((char *) &machine_endian_check)[0];
-	if (machine_little_endian) {
-		big_endian_long_map[0] = 3;
-		big_endian_long_map[1] = 2;
-		big_endian_long_map[2] = 1;
-		big_endian_long_map[3] = 0;
-	} else {
-		int size = sizeof(Z_LVAL_P(param));
-		big_endian_long_map[0] = size - 4;
-		big_endian_long_map[1] = size - 3;
-		big_endian_long_map[2] = size - 2;
-		big_endian_long_map[3] = size - 1;
-	}
+	length = Z_STRLEN_P(param);
 
 	/**
 	 * The input must be a valid UTF-32 string
 	 */
-	if ((Z_STRLEN_P(param) % 4) != 0) {
+	if (length <= 0 || (length % 4) != 0) {
+		if (use_copy) {
+			zval_dtor(param);
+		}
 		RETURN_FALSE;
 	}
 
-	for (i = 0; i < Z_STRLEN_P(param); i += 4) {
-
-		issigned = Z_STRVAL_P(param)[i] & 0x80;
+	/**
+	 * Every character produces at most the escape sequence, 8 hexadecimal digits and the extra character
+	 */
+	str = (const unsigned char *) Z_STRVAL_P(param);
+	escaped = emalloc((length / 4) * (escape_length + 9) + 1);
 
-		value = 0;
-		if (sizeof(long) > 4 && issigned) {
-			value = ~INT_MAX;
-		}
+	for (i = 0; i < length; i += 4) {
 
-		value |= zephir_unpack(&Z_STRVAL_P(param)[i], 4, issigned, big_endian_long_map);
-		if (sizeof(long) > 4) {
-			value = (unsigned int) value;
-		}
+		value = ((unsigned long) str[i] << 24) | ((unsigned long) str[i + 1] << 16) | ((unsigned long) str[i + 2] << 8) | (unsigned long) str[i + 3];
 
 		/**
 		 * CSS 2.1 section 4.1.3: "It is undefined in CSS 2.1 what happens if a
 		 * style sheet does contain a character with Unicode codepoint zero."
 		 */
 		if (value == '\0') {
+			efree(escaped);
+			if (use_copy) {
+				zval_dtor(param);
+			}
 			RETURN_FALSE;
 		}
 
 		/**
-		 * Alphanumeric characters are not escaped
-		 */
-		if (value < 256 && isalnum(value)) {
-			smart_str_appendc(&escaped_str, (unsigned char) value);
-			continue;
-		}
-
-		/**
-		 * Chararters in the whitelist are left as they are
+		 * Alphanumeric characters and characters in the whitelist are not escaped
 		 */
-		if (use_whitelist) {
-			switch (value) {
-				case ' ':
-				case '/':
-				case '*':
-				case '+':
-				case '-':
-				case '\t':
-				case '\n':
-				case '^':
-				case '$':
-				case '!':
-				case '?':
-				case '\\':
-				case '#':
-				case '}':
-				case '{':
-				case ')':
-				case '(':
-				case ']':
-				case '[':
-				case '.':
-				case ',':
-				case ':':
-				case ';':
-				case '_':
-				case '|':
-					smart_str_appendc(&escaped_str, (unsigned char) value);
-					continue;
+		if (value < 128) {
+			if (zephir_escape_map[value] & mask) {
+				escaped[escaped_length++] = (char) value;
+				continue;
+			}
+		} else {
+			if (value < 256 && isalnum(value)) {
+				escaped[escaped_length++] = (char) value;
+				continue;
 			}
 		}
 
-		/**
-		 * Convert character to hexadecimal
-		 */
-		hex = zephir_longtohex(value);
-
-		/**
-		 * Append the escaped character
-		 */
-		smart_str_appendl(&escaped_str, escape_char, escape_length);
-		smart_str_appendl(&escaped_str, hex, strlen(hex));
-		if (escape_extra != '\0') {
-			smart_str_appendc(&escaped_str, escape_extra);
-		}
-
-		efree(hex);
+		escaped_length += zephir_escape_char(escaped + escaped_length, value, escape_char, escape_length, escape_extra);
 	}
 
 	if (use_copy) {
 		zval_dtor(param);
 	}
 
-	smart_str_0(&escaped_str);
+	escaped[escaped_length] = '\0';
+	RETURN_STRINGL(escaped, escaped_length, 0);
+}
 
-	if (escaped_str.c) {
-		RETURN_STRINGL(escaped_str.c, escaped_str.len, 0);
-	} else {
-		RETURN_EMPTY_STRING();
+/**
+ * Performs the same escaping of zephir_escape_multi on a single byte ASCII string, runs of
+ * characters that don't need to be escaped are copied at once and the string is returned as
+ * it is if nothing needs to be escaped. Returns false if the string is empty or has bytes
+ * that are not ASCII, the caller must then convert it to UTF-32
+ */
+void zephir_escape_multi_ascii(zval *return_value, zval *param, const char *escape_char, unsigned int escape_length, char escape_extra, int use_whitelist) {
+
+	size_t i, span, length, escaped_length;
+	const unsigned char *str;
+	char *escaped;
+	unsigned char mask = use_whitelist ? ZEPHIR_ESCAPE_WHITELIST : ZEPHIR_ESCAPE_ALNUM;
+
+	if (Z_TYPE_P(param) != IS_STRING || Z_STRLEN_P(param) <= 0) {
+		RETURN_FALSE;
 	}
+
+	str = (const unsigned char *) Z_STRVAL_P(param);
+	length = Z_STRLEN_P(param);
+
+	span = zephir_escape_safe_span(str, length, mask);
+	if (span == length) {
+		RETURN_ZVAL(param, 1, 0);
+	}
+
+	/**
+	 * Characters below 128 produce at most the escape sequence, 2 hexadecimal digits and the extra character
+	 */
+	escaped = emalloc(span + (length - span) * (escape_length + 3) + 1);
+	memcpy(escaped, str, span);
+	escaped_length = span;
+	i = span;
+
+	while (i < length) {
+
+		/**
+		 * Only ASCII characters can be escaped here, the codepoint zero is not accepted either
+		 */
+		if (str[i] == '\0' || str[i] >= 128) {
+			efree(escaped);
+			RETURN_FALSE;
+		}
+
+		escaped_length += zephir_escape_char(escaped + escaped_length, str[i], escape_char, escape_length, escape_extra);
+		i++;
+
+		span = zephir_escape_safe_span(str + i, length - i, mask);
+		memcpy(escaped + escaped_length, str + i, span);
+		escaped_length += span;
+		i += span;
+	}
+
+	escaped[escaped_length] = '\0';
+	RETURN_STRINGL(escaped, escaped_length, 0);
 }
 
 /**
@@ -348,6 +428,20 @@ void zephir_escape_htmlattr(zval *return_value, zval *param) {
 	zephir_escape_multi(return_value, param, "&#x", sizeof("&#x")-1, ';', 1);
 }
 
+/**
+ * Escapes non-alphanumeric ASCII characters to \HH+space, returns false for non ASCII strings
+ */
+void zephir_escape_css_ascii(zval *return_value, zval *param) {
+	zephir_escape_multi_ascii(return_value, param, "\\", sizeof("\\")-1, ' ', 0);
+}
+
+/**
+ * Escapes non-alphanumeric ASCII characters to \xHH+, returns false for non ASCII strings
+ */
+void zephir_escape_js_ascii(zval *return_value, zval *param) {
+	zephir_escape_multi_ascii(return_value, param, "\\x", sizeof("\\x")-1, '\0', 1);
+}
+
 /**
  * Escapes HTML replacing special chars by entities
  */
@@ -33,6 +33,8 @@ void zephir_is_basic_charset(zval *return_value, const zval *param);
 void zephir_escape_css(zval *return_value, zval *param);
 void zephir_escape_js(zval *return_value, zval *param);
 void zephir_escape_htmlattr(zval *return_value, zval *param);
+void zephir_escape_css_ascii(zval *return_value, zval *param);
+void zephir_escape_js_ascii(zval *return_value, zval *param);
 void zephir_escape_html(zval *return_value, zval *str, zval *quote_style, zval *charset TSRMLS_DC);
 
 #endif
\ No newline at end of file
@@ -305,3 +305,296 @@ void phalcon_replace_paths(zval *return_value, zval *pattern, zval *paths, zval
 	}
 
 }
+
+/**
+ * Returns the name of the replacement a marker of a route pattern is filled with, following
+ * the same rules as phalcon_replace_marker() but without looking at the replacements
+ */
+static char *phalcon_template_marker(int named, zval *paths, unsigned long *position, char *cursor, char *marker, unsigned int *key_length){
+
+	zval **zv;
+	unsigned int length = 0, variable_length = 0, ch, j;
+	char *item = NULL, *cursor_var, *variable = NULL;
+	int not_valid = 0;
+
+	if (named) {
+		length = cursor - marker - 1;
+		item = estrndup(marker + 1, length);
+		cursor_var = item;
+		marker = item;
+		for (j = 0; j < length; j++) {
+			ch = *cursor_var;
+			if (ch == '\0') {
+				not_valid = 1;
+				break;
+			}
+			if (j == 0 && !((ch >= 'a' && ch <='z') || (ch >= 'A' && ch <= 'Z'))){
+				not_valid = 1;
+				break;
+			}
+			if ((ch >= 'a' && ch <='z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '-' || ch == '_' || ch ==  ':') {
+				if (ch == ':') {
+					variable_length = cursor_var - marker;
+					variable = estrndup(marker, variable_length);
+					break;
+				}
+			} else {
+				not_valid = 1;
+				break;
+			}
+			cursor_var++;
+		}
+	}
+
+	if (not_valid) {
+		efree(item);
+		return NULL;
+	}
+
+	if (zend_hash_index_exists(Z_ARRVAL_P(paths), *position)) {
+		if (named) {
+			(*position)++;
+			if (variable) {
+				efree(item);
+				*key_length = variable_length;
+				return variable;
+			}
+			*key_length = length;
+			return item;
+		}
+		if (zend_hash_index_find(Z_ARRVAL_P(paths), *position, (void**) &zv) == SUCCESS) {
+			if (Z_TYPE_PP(zv) == IS_STRING) {
+				(*position)++;
+				*key_length = Z_STRLEN_PP(zv);
+				return estrndup(Z_STRVAL_PP(zv), Z_STRLEN_PP(zv));
+			}
+		}
+	}
+
+	(*position)++;
+
+	if (item) {
+		efree(item);
+	}
+	if (variable) {
+		efree(variable);
+	}
+
+	return NULL;
+}
+
+/**
+ * Moves the pending literal text of a template to the template
+ */
+static void phalcon_template_literal(zval *template, smart_str *literal){
+
+	if (literal->len) {
+		smart_str_0(literal);
+		add_next_index_stringl(template, literal->c, literal->len, 0);
+		literal->c = NULL;
+		literal->len = 0;
+		literal->a = 0;
+	}
+}
+
+/**
+ * Adds a replacement to a template, replacements are stored as arrays with the name in the first position
+ */
+static void phalcon_template_replacement(zval *template, smart_str *literal, char *key, unsigned int key_length){
+
+	zval *replacement;
+
+	if (!key) {
+		return;
+	}
+
+	phalcon_template_literal(template, literal);
+
+	MAKE_STD_ZVAL(replacement);
+	array_init_size(replacement, 1);
+	add_next_index_stringl(replacement, key, key_length, 0);
+	add_next_index_zval(template, replacement);
+}
+
+/**
+ * Splits a route pattern into the literal parts and the names of the replacements that
+ * phalcon_replace_paths() would put in its markers, so URLs can be built by phalcon_fill_template()
+ * without parsing the pattern again
+ */
+void phalcon_reverse_template(zval *return_value, zval *pattern, zval *paths TSRMLS_DC){
+
+	char *cursor, *marker = NULL, *key;
+	unsigned int bracket_count = 0, parentheses_count = 0, intermediate = 0, key_length = 0;
+	unsigned char ch;
+	smart_str literal = {0};
+	ulong position = 1;
+	int i;
+	int looking_placeholder = 0;
+
+	if (Z_TYPE_P(pattern) != IS_STRING || Z_TYPE_P(paths) != IS_ARRAY) {
+		ZVAL_NULL(return_value);
+		php_error_docref(NULL TSRMLS_CC, E_WARNING, "Invalid arguments supplied for phalcon_reverse_template()");
+		return;
+	}
+
+	array_init(return_value);
+
+	if (Z_STRLEN_P(pattern) <= 0) {
+		return;
+	}
+
+	cursor = Z_STRVAL_P(pattern);
+	if (*cursor == '/') {
+		++cursor;
+		i = 1;
+	}
+	else {
+		i = 0;
+	}
+
+	if (!zend_hash_num_elements(Z_ARRVAL_P(paths))) {
+		if (Z_STRLEN_P(pattern) - i > 0) {
+			add_next_index_stringl(return_value, Z_STRVAL_P(pattern) + i, Z_STRLEN_P(pattern) - i, 1);
+		}
+		return;
+	}
+
+	for (; i < Z_STRLEN_P(pattern); ++i) {
+
+		ch = *cursor;
+		if (ch == '\0') {
+			break;
+		}
+
+		if (parentheses_count == 0 && !looking_placeholder) {
+			if (ch == '{') {
+				if (bracket_count == 0) {
+					marker = cursor;
+					intermediate = 0;
+				}
+				bracket_count++;
+			} else {
+				if (ch == '}') {
+					bracket_count--;
+					if (intermediate > 0) {
+						if (bracket_count == 0) {
+							key = phalcon_template_marker(1, paths, &position, cursor, marker, &key_length);
+							phalcon_template_replacement(return_value, &literal, key, key_length);
+							cursor++;
+							continue;
+						}
+					}
+				}
+			}
+		}
+
+		if (bracket_count == 0 && !looking_placeholder) {
+			if (ch == '(') {
+				if (parentheses_count == 0) {
+					marker = cursor;
+					intermediate = 0;
+				}
+				parentheses_count++;
+			} else {
+				if (ch == ')') {
+					parentheses_count--;
+					if (intermediate > 0) {
+						if (parentheses_count == 0) {
+							key = phalcon_template_marker(0, paths, &position, cursor, marker, &key_length);
+							phalcon_template_replacement(return_value, &literal, key, key_length);
+							cursor++;
+							continue;
+						}
+					}
+				}
+			}
+		}
+
+		if (bracket_count == 0 && parentheses_count == 0) {
+			if (looking_placeholder) {
+				if (intermediate > 0) {
+					if (ch < 'a' || ch > 'z' || i == (Z_STRLEN_P(pattern) - 1)) {
+						key = phalcon_template_marker(0, paths, &position, cursor, marker, &key_length);
+						phalcon_template_replacement(return_value, &literal, key, key_length);
+						looking_placeholder = 0;
+						continue;
+					}
+				}
+			} else {
+				if (ch == ':') {
+					looking_placeholder = 1;
+					marker = cursor;
+					intermediate = 0;
+				}
+			}
+		}
+
+		if (bracket_count > 0 || parentheses_count > 0 || looking_placeholder) {
+			intermediate++;
+		} else {
+			smart_str_appendc(&literal, ch);
+		}
+
+		cursor++;
+	}
+
+	phalcon_template_literal(return_value, &literal);
+	smart_str_free(&literal);
+}
+
+/**
+ * Builds a URI from a template returned by phalcon_reverse_template()
+ */
+void phalcon_fill_template(zval *return_value, zval *template, zval *replacements TSRMLS_DC){
+
+	HashPosition pos;
+	zval **token, **key, **replace, replace_copy;
+	smart_str uri = {0};
+	int use_copy;
+
+	if (Z_TYPE_P(template) != IS_ARRAY || Z_TYPE_P(replacements) != IS_ARRAY) {
+		ZVAL_NULL(return_value);
+		php_error_docref(NULL TSRMLS_CC, E_WARNING, "Invalid arguments supplied for phalcon_fill_template()");
+		return;
+	}
+
+	for (
+		zend_hash_internal_pointer_reset_ex(Z_ARRVAL_P(template), &pos);
+		zend_hash_get_current_data_ex(Z_ARRVAL_P(template), (void**) &token, &pos) == SUCCESS;
+		zend_hash_move_forward_ex(Z_ARRVAL_P(template), &pos)
+	) {
+
+		if (Z_TYPE_PP(token) == IS_STRING) {
+			smart_str_appendl(&uri, Z_STRVAL_PP(token), Z_STRLEN_PP(token));
+			continue;
+		}
+
+		if (Z_TYPE_PP(token) != IS_ARRAY || zend_hash_index_find(Z_ARRVAL_PP(token), 0, (void**) &key) != SUCCESS || Z_TYPE_PP(key) != IS_STRING) {
+			continue;
+		}
+
+		if (zend_hash_find(Z_ARRVAL_P(replacements), Z_STRVAL_PP(key), Z_STRLEN_PP(key) + 1, (void**) &replace) == SUCCESS) {
+			if (Z_TYPE_PP(replace) == IS_STRING) {
+				smart_str_appendl(&uri, Z_STRVAL_PP(replace), Z_STRLEN_PP(replace));
+			} else {
+				use_copy = 0;
+				zend_make_printable_zval(*replace, &replace_copy, &use_copy);
+				if (use_copy) {
+					smart_str_appendl(&uri, Z_STRVAL(replace_copy), Z_STRLEN(replace_copy));
+					zval_dtor(&replace_copy);
+				} else {
+					smart_str_appendl(&uri, Z_STRVAL_PP(replace), Z_STRLEN_PP(replace));
+				}
+			}
+		}
+	}
+
+	smart_str_0(&uri);
+
+	if (uri.len) {
+		RETURN_STRINGL(uri.c, uri.len, 0);
+	} else {
+		smart_str_free(&uri);
+		RETURN_EMPTY_STRING();
+	}
+}
@@ -26,5 +26,7 @@
 void phalcon_get_uri(zval *return_value, zval *path);
 void phalcon_extract_named_params(zval *return_value, zval *str, zval *matches);
 void phalcon_replace_paths(zval *return_value, zval *pattern, zval *paths, zval *uri TSRMLS_DC);
+void phalcon_reverse_template(zval *return_value, zval *pattern, zval *paths TSRMLS_DC);
+void phalcon_fill_template(zval *return_value, zval *template, zval *replacements TSRMLS_DC);
 
 #endif /* PHALCON_MVC_URL_UTILS_H */
@@ -0,0 +1,257 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2016 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Annotations\Adapter;
+
+use Phalcon\Annotations\Adapter;
+use Phalcon\Annotations\Reflection;
+use Phalcon\Annotations\Exception;
+
+/**
+ * Phalcon\Annotations\Adapter\Index
+ *
+ * Stores the parsed annotations of many classes in a single PHP file. The index is
+ * usually built at deploy time, the opcode cache keeps it in shared memory and the
+ * Phalcon\Annotations\Reflection of a class is only created when it's requested.
+ * Every entry records the file the class was read from and its modification time,
+ * entries whose file changed are parsed again.
+ *
+ *<code>
+ * use Phalcon\Annotations\Adapter\Index;
+ *
+ * $annotations = new Index(['indexFile' => 'app/cache/annotations.php']);
+ *
+ * // At deploy time
+ * $annotations->build('app/controllers/', 'Store\\Controllers\\');
+ *</code>
+ */
+class Index extends Adapter
+{
+
+	protected _indexFile = "./annotations.php";
+
+	/**
+	 * Whether the modification time of the class files is checked
+	 */
+	protected _stat = true;
+
+	protected _index;
+
+	protected _autoSave = true;
+
+	/**
+	 * Phalcon\Annotations\Adapter\Index constructor
+	 *
+	 * @param array options
+	 */
+	public function __construct(options = null)
+	{
+		var indexFile, stat;
+
+		if typeof options == "array" {
+			if fetch indexFile, options["indexFile"] {
+				let this->_indexFile = indexFile;
+			}
+			if fetch stat, options["stat"] {
+				let this->_stat = (bool) stat;
+			}
+		}
+	}
+
+	/**
+	 * Returns the index, the file is only loaded once
+	 */
+	protected function _getIndex() -> array
+	{
+		var index, indexFile;
+
+		let index = this->_index;
+		if typeof index == "array" {
+			return index;
+		}
+
+		let indexFile = this->_indexFile,
+			index = null;
+
+		if file_exists(indexFile) {
+			let index = require indexFile;
+		}
+
+		if typeof index != "array" || !isset index["files"] || !isset index["classes"] {
+			let index = ["files": [], "classes": []];
+		}
+
+		let this->_index = index;
+		return index;
+	}
+
+	/**
+	 * Returns the names of the indexed classes
+	 */
+	public function getClasses() -> array
+	{
+		var index;
+
+		let index = this->_getIndex();
+		return array_keys(index["classes"]);
+	}
+
+	/**
+	 * Reads the parsed annotations of a class from the index
+	 *
+	 * @param string key
+	 * @return \Phalcon\Annotations\Reflection
+	 */
+	public function read(string! key) -> <Reflection> | boolean
+	{
+		var index, entry, path, mtime, reflection;
+
+		let index = this->_getIndex();
+
+		if !fetch entry, index["classes"][strtolower(key)] {
+			return false;
+		}
+
+		/**
+		 * Entries read from a file modified after the index was written are stale
+		 */
+		if this->_stat {
+			let path = entry[0];
+			if !fetch mtime, index["files"][path] {
+				return false;
+			}
+			if !file_exists(path) || filemtime(path) !== mtime {
+				return false;
+			}
+		}
+
+		let reflection = new Reflection(entry[1]),
+			this->_annotations[key] = reflection;
+
+		return reflection;
+	}
+
+	/**
+	 * Writes the parsed annotations of a class to the index
+	 */
+	public function write(string! key, <Reflection> data)
+	{
+		var reflection, index, files, classes, path;
+
+		/**
+		 * Classes without a file (internal classes) are not indexed
+		 */
+		let reflection = new \ReflectionClass(key),
+			path = reflection->getFileName();
+		if typeof path != "string" {
+			return;
+		}
+
+		let index = this->_getIndex(),
+			files = index["files"],
+			classes = index["classes"];
+
+		let files[path] = filemtime(path),
+			classes[strtolower(key)] = [path, data->getReflectionData()],
+			index["files"] = files,
+			index["classes"] = classes,
+			this->_index = index;
+
+		if this->_autoSave {
+			this->save();
+		}
+	}
+
+	/**
+	 * Parses the annotations of every class in a directory saving the index once
+	 */
+	public function build(string! directory, string namespaceName = null) -> array
+	{
+		var iterator, file, path, className, reader, parsedAnnotations, classes, e;
+		int length;
+
+		let directory = rtrim(directory, "\\/"),
+			length = strlen(directory) + 1,
+			reader = this->getReader(),
+			classes = [];
+
+		let this->_autoSave = false;
+
+		try {
+
+			let iterator = new \RecursiveIteratorIterator(new \RecursiveDirectoryIterator(directory, \FilesystemIterator::SKIP_DOTS));
+			for file in iterator {
+
+				let path = file->getPathname();
+				if !ends_with(path, ".php") {
+					continue;
+				}
+
+				/**
+				 * The class name is obtained from the relative path of the file
+				 */
+				let className = namespaceName . str_replace(["/", "\\"], "\\", substr(path, length, -4));
+
+				if !class_exists(className) && !interface_exists(className) {
+					require_once path;
+					if !class_exists(className) && !interface_exists(className) {
+						continue;
+					}
+				}
+
+				let parsedAnnotations = reader->parse(className);
+				if typeof parsedAnnotations == "array" {
+					this->write(className, new Reflection(parsedAnnotations));
+					let classes[] = className;
+				}
+			}
+
+		} catch \Exception, e {
+			let this->_autoSave = true;
+			throw e;
+		}
+
+		let this->_autoSave = true;
+		this->save();
+
+		return classes;
+	}
+
+	/**
+	 * Saves the index replacing the file atomically
+	 */
+	public function save() -> boolean
+	{
+		var indexFile, temporaryFile;
+
+		let indexFile = this->_indexFile,
+			temporaryFile = indexFile . "." . uniqid() . ".tmp";
+
+		if file_put_contents(temporaryFile, "<?php return " . var_export(this->_getIndex(), true) . "; ") === false {
+			throw new Exception("Annotations index cannot be written");
+		}
+
+		if !rename(temporaryFile, indexFile) {
+			unlink(temporaryFile);
+			throw new Exception("Annotations index cannot be written");
+		}
+
+		return true;
+	}
+}
@@ -46,6 +46,8 @@ class Manager
 
 	protected _implicitOutput = true;
 
+	protected _manifest;
+
 	/**
 	 * Phalcon\Assets\Manager
 	 *
@@ -63,7 +65,8 @@ class Manager
 	 */
 	public function setOptions(array! options) -> <Manager>
 	{
-		let this->_options = options;
+		let this->_options = options,
+			this->_manifest = null;
 		return this;
 	}
 
@@ -297,7 +300,7 @@ class Manager
 			collectionTargetPath, completeTargetPath, filteredJoinedContent, join,
 			$resource, filterNeeded, local, sourcePath, targetPath, path, prefixedPath,
 			attributes, parameters, html, useImplicitOutput, content, mustFilter,
-			filter, filteredContent, typeCss, targetUri;
+			filter, filteredContent, typeCss, targetUri, manifest;
 
 		let useImplicitOutput = this->_implicitOutput;
 
@@ -321,6 +324,43 @@ class Manager
 
 		let typeCss = "css";
 
+		/**
+		 * Joined collections built by build() are rendered from the manifest without
+		 * checking or filtering their resources
+		 */
+		if count(filters) && collection->getJoin() {
+
+			let manifest = this->getManifest();
+
+			if fetch targetUri, manifest[collection->getTargetUri()] {
+
+				if prefix {
+					let prefixedPath = prefix . targetUri;
+				} else {
+					let prefixedPath = targetUri;
+				}
+
+				let attributes = collection->getAttributes(),
+					parameters = [];
+				if typeof attributes == "array" {
+					let attributes[0] = prefixedPath;
+					let parameters[] = attributes;
+				} else {
+					let parameters[] = prefixedPath;
+				}
+				let parameters[] = collection->getTargetLocal();
+
+				let html = call_user_func_array(callback, parameters);
+
+				if useImplicitOutput == true {
+					echo html;
+					return output;
+				}
+
+				return html;
+			}
+		}
+
 		/**
 		 * Prepare options if the collection must be filtered
 		 */
@@ -829,6 +869,188 @@ class Manager
 		return this->outputInline(collection, "script");
 	}
 
+	/**
+	 * Returns the build manifest, the target URIs of the collections built by build()
+	 * indexed by the target URI of the collection
+	 */
+	public function getManifest() -> array
+	{
+		var manifest, manifestFile;
+
+		let manifest = this->_manifest;
+		if typeof manifest == "array" {
+			return manifest;
+		}
+
+		let manifest = null;
+		if fetch manifestFile, this->_options["manifest"] {
+			if file_exists(manifestFile) {
+				let manifest = require manifestFile;
+			}
+		}
+
+		if typeof manifest != "array" {
+			let manifest = [];
+		}
+
+		let this->_manifest = manifest;
+		return manifest;
+	}
+
+	/**
+	 * Filters and joins every joined collection that has filters, writing the result to a
+	 * file named by its content hash next to a precompressed .gz copy. The new target URIs
+	 * are saved to the manifest so output() renders the collections without touching the
+	 * resources. This is intended to be run at deploy time
+	 *
+	 *<code>
+	 * $assets = new \Phalcon\Assets\Manager(array(
+	 *     'manifest' => 'app/cache/assets.php'
+	 * ));
+	 *
+	 * $assets->collection('jsHeader')
+	 *     ->setTargetPath('public/production/final.js')
+	 *     ->setTargetUri('production/final.js')
+	 *     ->addJs('js/jquery.js')
+	 *     ->join(true)
+	 *     ->addFilter(new \Phalcon\Assets\Filters\Jsmin());
+	 *
+	 * $assets->build(); // production/final.3b8c1d0e9a4f.js
+	 *</code>
+	 */
+	public function build() -> array
+	{
+		var options, manifestFile, manifest, collection, targetUri, temporaryFile;
+
+		let options = this->_options;
+		if !fetch manifestFile, options["manifest"] {
+			throw new Exception("The 'manifest' option is required to build the collections");
+		}
+
+		let manifest = [];
+
+		if typeof this->_collections == "array" {
+			for collection in this->_collections {
+
+				if !count(collection->getFilters()) || !collection->getJoin() {
+					continue;
+				}
+
+				let targetUri = collection->getTargetUri();
+				if !targetUri {
+					throw new Exception("Collections must have a target URI to be built");
+				}
+
+				let manifest[targetUri] = this->_buildCollection(collection);
+			}
+		}
+
+		let temporaryFile = manifestFile . "." . uniqid() . ".tmp";
+
+		if file_put_contents(temporaryFile, "<?php return " . var_export(manifest, true) . "; ") === false {
+			throw new Exception("Assets manifest cannot be written");
+		}
+
+		if !rename(temporaryFile, manifestFile) {
+			unlink(temporaryFile);
+			throw new Exception("Assets manifest cannot be written");
+		}
+
+		let this->_manifest = manifest;
+
+		return manifest;
+	}
+
+	/**
+	 * Filters and joins the resources of a collection returning the hashed target URI
+	 */
+	protected function _buildCollection(<Collection> collection) -> string
+	{
+		var options, sourceBasePath = null, targetBasePath = null, collectionSourcePath,
+			completeSourcePath, collectionTargetPath, completeTargetPath, filters, filter,
+			$resource, content, joinedContent, hash, targetPath;
+
+		let options = this->_options;
+
+		fetch sourceBasePath, options["sourceBasePath"];
+		fetch targetBasePath, options["targetBasePath"];
+
+		let collectionSourcePath = collection->getSourcePath();
+		if collectionSourcePath {
+			let completeSourcePath = sourceBasePath . collectionSourcePath;
+		} else {
+			let completeSourcePath = sourceBasePath;
+		}
+
+		let collectionTargetPath = collection->getTargetPath();
+		if collectionTargetPath {
+			let completeTargetPath = targetBasePath . collectionTargetPath;
+		} else {
+			let completeTargetPath = targetBasePath;
+		}
+
+		if !completeTargetPath || is_dir(completeTargetPath) {
+			throw new Exception("Path '". completeTargetPath. "' is not a valid target path");
+		}
+
+		let filters = collection->getFilters(),
+			joinedContent = "";
+
+		for $resource in collection->getResources() {
+
+			let content = $resource->getContent(completeSourcePath);
+
+			if $resource->getFilter() {
+				for filter in filters {
+					if typeof filter != "object" {
+						throw new Exception("Filter is invalid");
+					}
+					let content = filter->filter(content);
+				}
+				if $resource->getType() != "css" {
+					let content .= ";";
+				}
+			}
+
+			let joinedContent .= content;
+		}
+
+		/**
+		 * The file name changes with the content, so it can be cached forever
+		 */
+		let hash = substr(md5(joinedContent), 0, 12),
+			targetPath = this->_getHashedPath(completeTargetPath, hash);
+
+		if file_put_contents(targetPath, joinedContent) === false {
+			throw new Exception("Path '". targetPath. "' cannot be written");
+		}
+
+		if function_exists("gzencode") {
+			if file_put_contents(targetPath . ".gz", gzencode(joinedContent, 9)) === false {
+				throw new Exception("Path '". targetPath. ".gz' cannot be written");
+			}
+		}
+
+		return this->_getHashedPath(collection->getTargetUri(), hash);
+	}
+
+	/**
+	 * Inserts a hash before the extension of a path
+	 */
+	protected function _getHashedPath(string! path, string! hash) -> string
+	{
+		var position, separator;
+
+		let position = strrpos(path, "."),
+			separator = strrpos(path, "/");
+
+		if position === false || (separator !== false && position < separator) {
+			return path . "." . hash;
+		}
+
+		return substr(path, 0, position) . "." . hash . substr(path, position);
+	}
+
 	/**
 	 * Returns existing collections in the manager
 	 */
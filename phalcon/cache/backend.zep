@@ -43,6 +43,8 @@ abstract class Backend
 
 	protected _started = false;
 
+	protected _staleLocks;
+
 	/**
 	 * Phalcon\Cache\Backend constructor
 	 *
@@ -127,6 +129,211 @@ abstract class Backend
 		return this->_started;
 	}
 
+	/**
+	 * Returns several cached contents at once, missing keys are returned as null.
+	 * Adapters override this method to fetch all the keys in a single round-trip
+	 *
+	 *<code>
+	 * $contents = $cache->getMultiple(array('header', 'sidebar', 'footer'));
+	 *</code>
+	 *
+	 * @param array keys
+	 * @param int lifetime
+	 * @return array
+	 */
+	public function getMultiple(array! keys, var lifetime = null) -> array
+	{
+		var results, keyName;
+
+		let results = [];
+		for keyName in keys {
+			let results[keyName] = this->{"get"}(keyName, lifetime);
+		}
+
+		return results;
+	}
+
+	/**
+	 * Stores several contents at once, the frontend buffer is not stopped
+	 *
+	 *<code>
+	 * $cache->saveMultiple(array('header' => $header, 'footer' => $footer), 3600);
+	 *</code>
+	 *
+	 * @param array items
+	 * @param int lifetime
+	 * @return boolean
+	 */
+	public function saveMultiple(array! items, var lifetime = null) -> boolean
+	{
+		var keyName, content;
+
+		for keyName, content in items {
+			this->{"save"}(keyName, content, lifetime, false);
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several keys at once, returns false if any of them couldn't be deleted
+	 *
+	 * @param array keys
+	 * @return boolean
+	 */
+	public function deleteMultiple(array! keys) -> boolean
+	{
+		var keyName;
+		boolean success;
+
+		let success = true;
+		for keyName in keys {
+			if !this->{"delete"}(keyName) {
+				let success = false;
+			}
+		}
+
+		return success;
+	}
+
+	/**
+	 * Returns a content stored with saveStale(). Once the content expires only the
+	 * worker that acquires the key lock receives null and must regenerate it, the rest
+	 * of workers keep receiving the stale content for 'staleLifetime' seconds
+	 *
+	 *<code>
+	 * $robots = $cache->getStale('robots');
+	 * if ($robots === null) {
+	 *     $robots = Robots::find()->toArray();
+	 *     $cache->saveStale('robots', $robots);
+	 * }
+	 *</code>
+	 *
+	 * @param int|string keyName
+	 * @param int lifetime
+	 * @return mixed
+	 */
+	public function getStale(var keyName, var lifetime = null)
+	{
+		var ttl, staleLifetime, lockLifetime, envelope, content, expires, token;
+
+		let ttl = this->_getStaleLifetime(lifetime);
+
+		if !fetch staleLifetime, this->_options["staleLifetime"] {
+			let staleLifetime = 60;
+		}
+
+		/**
+		 * The envelope is kept by the backend during the stale window
+		 */
+		let envelope = this->{"get"}(keyName, ttl + staleLifetime);
+
+		if typeof envelope == "array" && fetch content, envelope["content"] && fetch expires, envelope["expires"] {
+			if expires > time() {
+				return content;
+			}
+		} else {
+			let content = null;
+		}
+
+		if !fetch lockLifetime, this->_options["lockLifetime"] {
+			let lockLifetime = 10;
+		}
+
+		/**
+		 * Only one worker recomputes an expired content
+		 */
+		let token = this->acquireLock(keyName, lockLifetime);
+		if token !== false {
+			let this->_staleLocks[keyName] = token;
+			return null;
+		}
+
+		return content;
+	}
+
+	/**
+	 * Stores a content that will be served stale while it is regenerated, the key lock
+	 * acquired by getStale() is released. A frontend that serializes data is required
+	 *
+	 * @param int|string keyName
+	 * @param mixed content
+	 * @param int lifetime
+	 */
+	public function saveStale(var keyName, var content, var lifetime = null) -> void
+	{
+		var ttl, staleLifetime, token;
+
+		let ttl = this->_getStaleLifetime(lifetime);
+
+		if !fetch staleLifetime, this->_options["staleLifetime"] {
+			let staleLifetime = 60;
+		}
+
+		this->{"save"}(keyName, ["content": content, "expires": time() + ttl], ttl + staleLifetime, false);
+
+		if fetch token, this->_staleLocks[keyName] {
+			unset this->_staleLocks[keyName];
+			this->releaseLock(keyName, token);
+		}
+	}
+
+	/**
+	 * Acquires a lock on a key returning the lock token or false if the lock
+	 * is held by another worker. Adapters override this method to use atomic operations
+	 *
+	 * @param int|string keyName
+	 * @param int lifetime
+	 * @return string|boolean
+	 */
+	public function acquireLock(var keyName, int lifetime = 10)
+	{
+		var lockKey, token;
+
+		let lockKey = "_PHCL" . keyName;
+		if this->{"exists"}(lockKey, lifetime) {
+			return false;
+		}
+
+		let token = uniqid("", true);
+		this->{"save"}(lockKey, token, lifetime, false);
+		return token;
+	}
+
+	/**
+	 * Releases a lock acquired by acquireLock() if it is still owned by the token
+	 *
+	 * @param int|string keyName
+	 * @param string token
+	 * @return boolean
+	 */
+	public function releaseLock(var keyName, string! token) -> boolean
+	{
+		var lockKey;
+
+		let lockKey = "_PHCL" . keyName;
+		if this->{"get"}(lockKey) !== token {
+			return false;
+		}
+
+		return this->{"delete"}(lockKey);
+	}
+
+	/**
+	 * Returns the lifetime used by the stale-while-revalidate mode
+	 */
+	protected function _getStaleLifetime(var lifetime) -> int
+	{
+		if lifetime === null {
+			let lifetime = this->_lastLifetime;
+			if !lifetime {
+				let lifetime = this->_frontend->getLifetime();
+			}
+		}
+
+		return (int) lifetime;
+	}
+
 	/**
 	 * Gets the last lifetime set
 	 *
@@ -201,6 +201,163 @@ class Apc extends Backend implements BackendInterface
 		return apc_delete("_PHCA" . this->_prefix . keyName);
 	}
 
+	/**
+	 * Returns several cached contents using a single apc_fetch call
+	 *
+	 * @param array keys
+	 * @param long lifetime
+	 * @return array
+	 */
+	public function getMultiple(array! keys, var lifetime = null) -> array
+	{
+		var prefix, prefixedKeys, keyName, values, results, cachedContent;
+
+		let results = [];
+		if !count(keys) {
+			return results;
+		}
+
+		let prefix = "_PHCA" . this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keys {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		let values = apc_fetch(prefixedKeys);
+		if typeof values != "array" {
+			let values = [];
+		}
+
+		for keyName in keys {
+			if fetch cachedContent, values[prefix . keyName] {
+				let results[keyName] = this->_frontend->afterRetrieve(cachedContent);
+			} else {
+				let results[keyName] = null;
+			}
+		}
+
+		return results;
+	}
+
+	/**
+	 * Stores several contents using a single apc_store call
+	 *
+	 * @param array items
+	 * @param long lifetime
+	 * @return boolean
+	 */
+	public function saveMultiple(array! items, var lifetime = null) -> boolean
+	{
+		var frontend, prefix, preparedItems, keyName, content, ttl, failed;
+
+		if !count(items) {
+			return true;
+		}
+
+		let frontend = this->_frontend,
+			prefix = "_PHCA" . this->_prefix,
+			preparedItems = [];
+
+		for keyName, content in items {
+			let preparedItems[prefix . keyName] = frontend->beforeStore(content);
+		}
+
+		/**
+		 * Take the lifetime from the frontend or read it from the set in start()
+		 */
+		if lifetime === null {
+			let lifetime = this->_lastLifetime;
+			if lifetime === null {
+				let ttl = frontend->getLifetime();
+			} else {
+				let ttl = lifetime;
+			}
+		} else {
+			let ttl = lifetime;
+		}
+
+		/**
+		 * apc_store returns the keys that couldn't be stored
+		 */
+		let failed = apc_store(preparedItems, null, ttl);
+		if typeof failed == "array" {
+			return !count(failed);
+		}
+
+		return (boolean) failed;
+	}
+
+	/**
+	 * Deletes several keys using a single apc_delete call
+	 *
+	 * @param array keys
+	 * @return boolean
+	 */
+	public function deleteMultiple(array! keys) -> boolean
+	{
+		var prefix, prefixedKeys, keyName, failed;
+
+		if !count(keys) {
+			return true;
+		}
+
+		let prefix = "_PHCA" . this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keys {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		/**
+		 * apc_delete returns the keys that couldn't be deleted
+		 */
+		let failed = apc_delete(prefixedKeys);
+		if typeof failed == "array" {
+			return !count(failed);
+		}
+
+		return (boolean) failed;
+	}
+
+	/**
+	 * Acquires a lock on a key using apc_add, the lock expires after lifetime seconds
+	 *
+	 * @param int|string keyName
+	 * @param int lifetime
+	 * @return string|boolean
+	 */
+	public function acquireLock(var keyName, int lifetime = 10)
+	{
+		var token;
+
+		let token = uniqid("", true);
+		if apc_add("_PHCL" . this->_prefix . keyName, token, lifetime) {
+			return token;
+		}
+
+		return false;
+	}
+
+	/**
+	 * Releases a lock if it is still owned by the token
+	 *
+	 * @param int|string keyName
+	 * @param string token
+	 * @return boolean
+	 */
+	public function releaseLock(var keyName, string! token) -> boolean
+	{
+		var lockKey;
+
+		let lockKey = "_PHCL" . this->_prefix . keyName;
+		if apc_fetch(lockKey) !== token {
+			return false;
+		}
+
+		return apc_delete(lockKey);
+	}
+
 	/**
 	 * Query the existing cached keys
 	 *
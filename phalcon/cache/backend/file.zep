@@ -64,6 +64,13 @@ class File extends Backend implements BackendInterface
 	 */
 	private _useSafeKey = false;
 
+	/**
+	 * Lock files handles indexed by lock token
+	 *
+	 * @var array
+	 */
+	protected _locks;
+
 	/**
 	 * Phalcon\Cache\Backend\File constructor
 	 *
@@ -250,6 +257,61 @@ class File extends Backend implements BackendInterface
 		return false;
 	}
 
+	/**
+	 * Acquires a lock on a key using flock on a lock file, the lock is held until
+	 * it is released or the process finishes
+	 *
+	 * @param int|string keyName
+	 * @param int lifetime
+	 * @return string|boolean
+	 */
+	public function acquireLock(var keyName, int lifetime = 10)
+	{
+		var cacheDir, handle, token;
+
+		if !fetch cacheDir, this->_options["cacheDir"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		let handle = fopen(cacheDir . "_PHCL" . this->_prefix . this->getKey(keyName), "c");
+		if !handle {
+			return false;
+		}
+
+		if !flock(handle, LOCK_EX | LOCK_NB) {
+			fclose(handle);
+			return false;
+		}
+
+		let token = uniqid("", true),
+			this->_locks[token] = handle;
+
+		return token;
+	}
+
+	/**
+	 * Releases a lock acquired by acquireLock()
+	 *
+	 * @param int|string keyName
+	 * @param string token
+	 * @return boolean
+	 */
+	public function releaseLock(var keyName, string! token) -> boolean
+	{
+		var handle;
+
+		if !fetch handle, this->_locks[token] {
+			return false;
+		}
+
+		unset this->_locks[token];
+
+		flock(handle, LOCK_UN);
+		fclose(handle);
+
+		return true;
+	}
+
 	/**
 	 * Query the existing cached keys
 	 *
@@ -272,6 +334,14 @@ class File extends Backend implements BackendInterface
 
 			if likely item->isDir() === false {
 				let key = item->getFileName();
+
+				/**
+				 * Lock files are not cached keys
+				 */
+				if starts_with(key, "_PHCL") {
+					continue;
+				}
+
 				if prefix !== null {
 					if starts_with(key, prefix) {
 						let keys[] = key;
@@ -295,6 +295,285 @@ class Libmemcached extends Backend implements BackendInterface
 		return ret;
 	}
 
+	/**
+	 * Refreshes the lifetime of a cached key without storing its content again
+	 *
+	 *<code>
+	 * $cache->touch('my-key', 3600);
+	 *</code>
+	 */
+	public function touch(keyName, lifetime = null) -> boolean
+	{
+		var memcache, tmp, ttl;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		if lifetime === null {
+			let tmp = this->_lastLifetime;
+
+			if !tmp {
+				let ttl = this->_frontend->getLifetime();
+			} else {
+				let ttl = tmp;
+			}
+		} else {
+			let ttl = lifetime;
+		}
+
+		return memcache->touch(this->_prefix . keyName, ttl);
+	}
+
+	/**
+	 * Returns several cached contents using a single getMulti call
+	 *
+	 * @param array keys
+	 * @param long lifetime
+	 * @return array
+	 */
+	public function getMultiple(array! keys, var lifetime = null) -> array
+	{
+		var memcache, frontend, prefix, prefixedKeys, keyName, values, results, cachedContent;
+
+		let results = [];
+		if !count(keys) {
+			return results;
+		}
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keys {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		let values = memcache->getMulti(prefixedKeys);
+		if typeof values != "array" {
+			let values = [];
+		}
+
+		for keyName in keys {
+
+			if !fetch cachedContent, values[prefix . keyName] || !cachedContent {
+				let results[keyName] = null;
+				continue;
+			}
+
+			if is_numeric(cachedContent) {
+				let results[keyName] = cachedContent;
+			} else {
+				let results[keyName] = frontend->afterRetrieve(cachedContent);
+			}
+		}
+
+		return results;
+	}
+
+	/**
+	 * Stores several contents using a single setMulti call, the stats key is updated once
+	 *
+	 * @param array items
+	 * @param long lifetime
+	 * @return boolean
+	 */
+	public function saveMultiple(array! items, var lifetime = null) -> boolean
+	{
+		var memcache, frontend, prefix, options, specialKey, tmp, ttl, keyName, content,
+			prefixedKey, preparedItems, keys;
+		boolean changed;
+
+		if !count(items) {
+			return true;
+		}
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix;
+
+		if lifetime === null {
+			let tmp = this->_lastLifetime;
+
+			if !tmp {
+				let ttl = frontend->getLifetime();
+			} else {
+				let ttl = tmp;
+			}
+		} else {
+			let ttl = lifetime;
+		}
+
+		let preparedItems = [];
+		for keyName, content in items {
+			if is_numeric(content) {
+				let preparedItems[prefix . keyName] = content;
+			} else {
+				let preparedItems[prefix . keyName] = frontend->beforeStore(content);
+			}
+		}
+
+		if !memcache->setMulti(preparedItems, ttl) {
+			throw new Exception("Failed storing data in memcached, error code: " . memcache->getResultCode());
+		}
+
+		let options = this->_options;
+
+		if !fetch specialKey, options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		if specialKey != "" {
+			/**
+			 * Update the stats key
+			 */
+			let keys = memcache->get(specialKey);
+			if typeof keys != "array" {
+				let keys = [];
+			}
+
+			let changed = false;
+			for prefixedKey, _ in preparedItems {
+				if !isset keys[prefixedKey] {
+					let keys[prefixedKey] = ttl,
+						changed = true;
+				}
+			}
+
+			if changed {
+				memcache->set(specialKey, keys);
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several keys using a single deleteMulti call, the stats key is updated once
+	 *
+	 * @param array keys
+	 * @return boolean
+	 */
+	public function deleteMultiple(array! keys) -> boolean
+	{
+		var memcache, prefix, options, specialKey, keyName, prefixedKeys, prefixedKey,
+			statsKeys, results, result;
+
+		if !count(keys) {
+			return true;
+		}
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let prefix = this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keys {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		let options = this->_options;
+
+		if !fetch specialKey, options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		if specialKey != "" {
+			let statsKeys = memcache->get(specialKey);
+			if typeof statsKeys == "array" {
+				for prefixedKey in prefixedKeys {
+					unset statsKeys[prefixedKey];
+				}
+				memcache->set(specialKey, statsKeys);
+			}
+		}
+
+		/**
+		 * Delete the keys from memcached
+		 */
+		let results = memcache->deleteMulti(prefixedKeys);
+		if typeof results != "array" {
+			return false;
+		}
+
+		for result in results {
+			if result !== true {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Acquires a lock on a key using the atomic add operation, the lock expires after lifetime seconds
+	 *
+	 * @param int|string keyName
+	 * @param int lifetime
+	 * @return string|boolean
+	 */
+	public function acquireLock(var keyName, int lifetime = 10)
+	{
+		var memcache, lockKey, token;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let lockKey = "_PHCL" . this->_prefix . keyName,
+			token = uniqid("", true);
+
+		if memcache->add(lockKey, token, lifetime) {
+			return token;
+		}
+
+		return false;
+	}
+
+	/**
+	 * Releases a lock if it is still owned by the token
+	 *
+	 * @param int|string keyName
+	 * @param string token
+	 * @return boolean
+	 */
+	public function releaseLock(var keyName, string! token) -> boolean
+	{
+		var memcache, lockKey;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let lockKey = "_PHCL" . this->_prefix . keyName;
+		if memcache->get(lockKey) !== token {
+			return false;
+		}
+
+		return memcache->delete(lockKey);
+	}
+
 	/**
 	 * Query the existing cached keys
 	 *
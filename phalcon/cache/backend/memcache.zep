@@ -290,6 +290,283 @@ class Memcache extends Backend implements BackendInterface
 		return ret;
 	}
 
+	/**
+	 * Refreshes the lifetime of a cached key.
+	 * The memcache extension has no TOUCH command so the stored value is read and replaced as it is,
+	 * without going through the frontend
+	 *
+	 *<code>
+	 * $cache->touch('my-key', 3600);
+	 *</code>
+	 */
+	public function touch(keyName, lifetime = null) -> boolean
+	{
+		var memcache, prefixedKey, content, tmp, ttl;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		if lifetime === null {
+			let tmp = this->_lastLifetime;
+
+			if !tmp {
+				let ttl = this->_frontend->getLifetime();
+			} else {
+				let ttl = tmp;
+			}
+		} else {
+			let ttl = lifetime;
+		}
+
+		let prefixedKey = this->_prefix . keyName,
+			content = memcache->get(prefixedKey);
+		if content === false {
+			return false;
+		}
+
+		return memcache->replace(prefixedKey, content, 0, ttl);
+	}
+
+	/**
+	 * Returns several cached contents using a single multi-key get
+	 *
+	 * @param array keys
+	 * @param long lifetime
+	 * @return array
+	 */
+	public function getMultiple(array! keys, var lifetime = null) -> array
+	{
+		var memcache, frontend, prefix, prefixedKeys, keyName, values, results, cachedContent;
+
+		let results = [];
+		if !count(keys) {
+			return results;
+		}
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			prefixedKeys = [];
+
+		for keyName in keys {
+			let prefixedKeys[] = prefix . keyName;
+		}
+
+		let values = memcache->get(prefixedKeys);
+		if typeof values != "array" {
+			let values = [];
+		}
+
+		for keyName in keys {
+
+			if !fetch cachedContent, values[prefix . keyName] || !cachedContent {
+				let results[keyName] = null;
+				continue;
+			}
+
+			if is_numeric(cachedContent) {
+				let results[keyName] = cachedContent;
+			} else {
+				let results[keyName] = frontend->afterRetrieve(cachedContent);
+			}
+		}
+
+		return results;
+	}
+
+	/**
+	 * Stores several contents, the stats key is updated once
+	 *
+	 * @param array items
+	 * @param long lifetime
+	 * @return boolean
+	 */
+	public function saveMultiple(array! items, var lifetime = null) -> boolean
+	{
+		var memcache, frontend, prefix, options, specialKey, tmp, ttl, keyName, content,
+			lastKey, success, keys;
+		boolean changed;
+
+		if !count(items) {
+			return true;
+		}
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix;
+
+		if lifetime === null {
+			let tmp = this->_lastLifetime;
+
+			if !tmp {
+				let ttl = frontend->getLifetime();
+			} else {
+				let ttl = tmp;
+			}
+		} else {
+			let ttl = lifetime;
+		}
+
+		let options = this->_options;
+
+		if !fetch specialKey, options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		if typeof specialKey != "null" {
+			let keys = memcache->get(specialKey);
+			if typeof keys != "array" {
+				let keys = [];
+			}
+		}
+
+		let changed = false;
+		for keyName, content in items {
+
+			let lastKey = prefix . keyName;
+
+			/**
+			 * We store without flags
+			 */
+			if is_numeric(content) {
+				let success = memcache->set(lastKey, content, 0, ttl);
+			} else {
+				let success = memcache->set(lastKey, frontend->beforeStore(content), 0, ttl);
+			}
+
+			if !success {
+				throw new Exception("Failed storing data in memcached");
+			}
+
+			if typeof specialKey != "null" && !isset keys[lastKey] {
+				let keys[lastKey] = ttl,
+					changed = true;
+			}
+		}
+
+		/**
+		 * Update the stats key
+		 */
+		if changed {
+			memcache->set(specialKey, keys);
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several keys, the stats key is updated once
+	 *
+	 * @param array keys
+	 * @return boolean
+	 */
+	public function deleteMultiple(array! keys) -> boolean
+	{
+		var memcache, prefix, options, specialKey, keyName, prefixedKey, statsKeys;
+		boolean success;
+
+		if !count(keys) {
+			return true;
+		}
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let prefix = this->_prefix,
+			options = this->_options;
+
+		if !fetch specialKey, options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		let statsKeys = memcache->get(specialKey),
+			success = true;
+
+		for keyName in keys {
+			let prefixedKey = prefix . keyName;
+			if typeof statsKeys == "array" {
+				unset statsKeys[prefixedKey];
+			}
+			if !memcache->delete(prefixedKey) {
+				let success = false;
+			}
+		}
+
+		if typeof statsKeys == "array" {
+			memcache->set(specialKey, statsKeys);
+		}
+
+		return success;
+	}
+
+	/**
+	 * Acquires a lock on a key using the atomic add operation, the lock expires after lifetime seconds
+	 *
+	 * @param int|string keyName
+	 * @param int lifetime
+	 * @return string|boolean
+	 */
+	public function acquireLock(var keyName, int lifetime = 10)
+	{
+		var memcache, lockKey, token;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let lockKey = "_PHCL" . this->_prefix . keyName,
+			token = uniqid("", true);
+
+		if memcache->add(lockKey, token, 0, lifetime) {
+			return token;
+		}
+
+		return false;
+	}
+
+	/**
+	 * Releases a lock if it is still owned by the token
+	 *
+	 * @param int|string keyName
+	 * @param string token
+	 * @return boolean
+	 */
+	public function releaseLock(var keyName, string! token) -> boolean
+	{
+		var memcache, lockKey;
+
+		let memcache = this->_memcache;
+		if typeof memcache != "object" {
+			this->_connect();
+			let memcache = this->_memcache;
+		}
+
+		let lockKey = "_PHCL" . this->_prefix . keyName;
+		if memcache->get(lockKey) !== token {
+			return false;
+		}
+
+		return memcache->delete(lockKey);
+	}
+
 	/**
 	 * Query the existing cached keys
 	 *
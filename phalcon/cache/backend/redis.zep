@@ -303,6 +303,262 @@ class Redis extends Backend implements BackendInterface
 		return redis->delete(lastKey);
 	}
 
+	/**
+	 * Refreshes the lifetime of a cached key without storing its content again
+	 *
+	 *<code>
+	 * $cache->touch('my-key', 3600);
+	 *</code>
+	 */
+	public function touch(keyName, lifetime = null) -> boolean
+	{
+		var redis, tmp, ttl;
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		if lifetime === null {
+			let tmp = this->_lastLifetime;
+
+			if !tmp {
+				let ttl = this->_frontend->getLifetime();
+			} else {
+				let ttl = tmp;
+			}
+		} else {
+			let ttl = lifetime;
+		}
+
+		return redis->settimeout("_PHCR" . this->_prefix . keyName, ttl);
+	}
+
+	/**
+	 * Returns several cached contents using a single MGET command
+	 *
+	 * @param array keys
+	 * @param long lifetime
+	 * @return array
+	 */
+	public function getMultiple(array! keys, var lifetime = null) -> array
+	{
+		var redis, frontend, prefix, lastKeys, keyName, values, results, cachedContent, position;
+
+		let results = [];
+		if !count(keys) {
+			return results;
+		}
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix,
+			keys = array_values(keys),
+			lastKeys = [];
+
+		for keyName in keys {
+			let lastKeys[] = "_PHCR" . prefix . keyName;
+		}
+
+		let values = redis->mget(lastKeys);
+
+		for position, keyName in keys {
+
+			if !fetch cachedContent, values[position] || !cachedContent {
+				let results[keyName] = null;
+				continue;
+			}
+
+			if is_numeric(cachedContent) {
+				let results[keyName] = cachedContent;
+			} else {
+				let results[keyName] = frontend->afterRetrieve(cachedContent);
+			}
+		}
+
+		return results;
+	}
+
+	/**
+	 * Stores several contents sending all the commands in a single pipeline
+	 *
+	 * @param array items
+	 * @param long lifetime
+	 * @return boolean
+	 */
+	public function saveMultiple(array! items, var lifetime = null) -> boolean
+	{
+		var redis, frontend, prefix, options, specialKey, tmp, ttl, keyName, content,
+			prefixedKey, lastKey, results, success;
+
+		if !count(items) {
+			return true;
+		}
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		let options = this->_options;
+		if !fetch specialKey, options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		let frontend = this->_frontend,
+			prefix = this->_prefix;
+
+		if lifetime === null {
+			let tmp = this->_lastLifetime;
+
+			if !tmp {
+				let ttl = frontend->getLifetime();
+			} else {
+				let ttl = tmp;
+			}
+		} else {
+			let ttl = lifetime;
+		}
+
+		redis->multi(\Redis::PIPELINE);
+
+		for keyName, content in items {
+
+			let prefixedKey = prefix . keyName,
+				lastKey = "_PHCR" . prefixedKey;
+
+			if is_numeric(content) {
+				redis->set(lastKey, content);
+			} else {
+				redis->set(lastKey, frontend->beforeStore(content));
+			}
+
+			redis->settimeout(lastKey, ttl);
+			redis->sAdd(specialKey, prefixedKey);
+		}
+
+		let results = redis->exec();
+		if typeof results != "array" {
+			throw new Exception("Failed storing the data in redis");
+		}
+
+		for success in results {
+			if success === false {
+				throw new Exception("Failed storing the data in redis");
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several keys sending all the commands in a single pipeline
+	 *
+	 * @param array keys
+	 * @return boolean
+	 */
+	public function deleteMultiple(array! keys) -> boolean
+	{
+		var redis, prefix, options, specialKey, keyName, prefixedKey, lastKeys, results;
+
+		if !count(keys) {
+			return true;
+		}
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		let options = this->_options;
+		if !fetch specialKey, options["statsKey"] {
+			throw new Exception("Unexpected inconsistency in options");
+		}
+
+		let prefix = this->_prefix,
+			lastKeys = [];
+
+		redis->multi(\Redis::PIPELINE);
+
+		for keyName in keys {
+			let prefixedKey = prefix . keyName,
+				lastKeys[] = "_PHCR" . prefixedKey;
+			redis->sRem(specialKey, prefixedKey);
+		}
+
+		redis->delete(lastKeys);
+
+		let results = redis->exec();
+		if typeof results != "array" || !count(results) {
+			return false;
+		}
+
+		/**
+		 * The last reply is the number of deleted keys
+		 */
+		return results[count(results) - 1] == count(lastKeys);
+	}
+
+	/**
+	 * Acquires a lock on a key using SET NX, the lock expires after lifetime seconds
+	 *
+	 * @param int|string keyName
+	 * @param int lifetime
+	 * @return string|boolean
+	 */
+	public function acquireLock(var keyName, int lifetime = 10)
+	{
+		var redis, token, options;
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		let token = uniqid("", true),
+			options = ["ex": lifetime];
+		let options[] = "nx";
+
+		if redis->set("_PHCL" . this->_prefix . keyName, token, options) {
+			return token;
+		}
+
+		return false;
+	}
+
+	/**
+	 * Releases a lock if it is still owned by the token, the check and the deletion are atomic
+	 *
+	 * @param int|string keyName
+	 * @param string token
+	 * @return boolean
+	 */
+	public function releaseLock(var keyName, string! token) -> boolean
+	{
+		var redis;
+
+		let redis = this->_redis;
+		if typeof redis != "object" {
+			this->_connect();
+			let redis = this->_redis;
+		}
+
+		return redis->eval(
+			"if redis.call('get', KEYS[1]) == ARGV[1] then return redis.call('del', KEYS[1]) else return 0 end",
+			["_PHCL" . this->_prefix . keyName, token],
+			1
+		) == 1;
+	}
+
 	/**
 	 * Query the existing cached keys
 	 *
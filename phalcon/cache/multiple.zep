@@ -165,6 +165,106 @@ class Multiple
 		return true;
 	}
 
+	/**
+	 * Returns several cached contents reading the internal backends, keys missing in a
+	 * backend are requested to the next one. Missing keys are returned as null
+	 *
+	 * @param array keys
+	 * @param long lifetime
+	 * @return array
+	 */
+	public function getMultiple(array! keys, lifetime = null) -> array
+	{
+		var backend, results, pending, contents, keyName, content;
+
+		let results = [],
+			pending = [];
+
+		for keyName in keys {
+			let results[keyName] = null,
+				pending[] = keyName;
+		}
+
+		for backend in this->_backends {
+
+			if !count(pending) {
+				break;
+			}
+
+			if method_exists(backend, "getMultiple") {
+				let contents = backend->getMultiple(pending, lifetime);
+			} else {
+				let contents = [];
+				for keyName in pending {
+					let contents[keyName] = backend->get(keyName, lifetime);
+				}
+			}
+
+			let pending = [];
+			for keyName in keys {
+				if results[keyName] != null {
+					continue;
+				}
+				if fetch content, contents[keyName] {
+					if content != null {
+						let results[keyName] = content;
+						continue;
+					}
+				}
+				let pending[] = keyName;
+			}
+		}
+
+		return results;
+	}
+
+	/**
+	 * Stores several contents into all backends
+	 *
+	 * @param array items
+	 * @param long lifetime
+	 * @return boolean
+	 */
+	public function saveMultiple(array! items, lifetime = null) -> boolean
+	{
+		var backend, keyName, content;
+
+		for backend in this->_backends {
+			if method_exists(backend, "saveMultiple") {
+				backend->saveMultiple(items, lifetime);
+			} else {
+				for keyName, content in items {
+					backend->save(keyName, content, lifetime, false);
+				}
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * Deletes several keys from each backend
+	 *
+	 * @param array keys
+	 * @return boolean
+	 */
+	public function deleteMultiple(array! keys) -> boolean
+	{
+		var backend, keyName;
+
+		for backend in this->_backends {
+			if method_exists(backend, "deleteMultiple") {
+				backend->deleteMultiple(keys);
+			} else {
+				for keyName in keys {
+					backend->delete(keyName);
+				}
+			}
+		}
+
+		return true;
+	}
+
 	/**
 	 * Checks if cache exists in at least one backend
 	 *
@@ -0,0 +1,56 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2016 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Cli\Task;
+
+use Phalcon\Cli\Task;
+use Phalcon\Assets\Exception;
+
+/**
+ * Phalcon\Cli\Task\AssetsTask
+ *
+ * Builds the joined collections of the 'assets' service and their manifest, see
+ * Phalcon\Assets\Manager::build()
+ *
+ *<code>
+ *	// php app/cli.php Phalcon\\Cli\\Task\\Assets build
+ *	$console->handle(array(
+ *		'task'   => 'Phalcon\Cli\Task\Assets',
+ *		'action' => 'build'
+ *	));
+ *</code>
+ */
+class AssetsTask extends Task
+{
+
+	/**
+	 * Filters, joins and compresses the collections writing the manifest
+	 */
+	public function buildAction() -> array
+	{
+		var assets;
+
+		let assets = this->getDI()->getShared("assets");
+		if typeof assets != "object" {
+			throw new Exception("The 'assets' service is not available");
+		}
+
+		return assets->build();
+	}
+}
@@ -0,0 +1,80 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2016 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Cli\Task;
+
+use Phalcon\Cli\Task;
+use Phalcon\Mvc\Router\Exception;
+
+/**
+ * Phalcon\Cli\Task\RoutesTask
+ *
+ * Exports the route table of the 'router' service to a PHP file, the router imports
+ * it with Phalcon\Mvc\Router::importRoutes() instead of adding and compiling every route
+ *
+ *<code>
+ *	// php app/cli.php Phalcon\\Cli\\Task\\Routes compile app/cache/routes.php
+ *	$console->handle(array(
+ *		'task'   => 'Phalcon\Cli\Task\Routes',
+ *		'action' => 'compile',
+ *		'params' => array('app/cache/routes.php')
+ *	));
+ *
+ *	// In the web application
+ *	$router->importRoutes(require 'app/cache/routes.php');
+ *</code>
+ */
+class RoutesTask extends Task
+{
+
+	/**
+	 * Writes the routes of the 'router' service to a PHP file
+	 */
+	public function compileAction(string path = null) -> int
+	{
+		var router, routes, temporaryFile;
+
+		if empty path {
+			throw new Exception("The path of the compiled routes file is required");
+		}
+
+		let router = this->getDI()->getShared("router");
+
+		/**
+		 * Routes defined by annotations are only added when the URI matches their prefix
+		 */
+		if method_exists(router, "loadResources") {
+			router->{"loadResources"}();
+		}
+
+		let routes = router->exportRoutes(),
+			temporaryFile = path . "." . uniqid() . ".tmp";
+
+		if file_put_contents(temporaryFile, "<?php return " . var_export(routes, true) . "; ") === false {
+			throw new Exception("Compiled routes file cannot be written");
+		}
+
+		if !rename(temporaryFile, path) {
+			unlink(temporaryFile);
+			throw new Exception("Compiled routes file cannot be written");
+		}
+
+		return count(routes);
+	}
+}
@@ -414,6 +414,211 @@ abstract class Adapter implements EventsAwareInterface
 		return this->insert(table, values, fields, dataTypes);
 	}
 
+	/**
+	 * Inserts several rows using multi-row INSERT statements. Rows are grouped in chunks
+	 * respecting the maximum number of rows and bound parameters supported by the dialect,
+	 * if more than one statement is required all of them are executed in a transaction
+	 *
+	 * <code>
+	 * //Inserting several robots
+	 * $success = $connection->insertMultiple(
+	 *	 "robots",
+	 *	 array(
+	 *		 array("Astro Boy", 1952),
+	 *		 array("Terminator", 1984)
+	 *	 ),
+	 *	 array("name", "year")
+	 * );
+	 *
+	 * //Next SQL sentence is sent to the database system
+	 * INSERT INTO `robots` (`name`, `year`) VALUES ("Astro boy", 1952), ("Terminator", 1984);
+	 * </code>
+	 *
+	 * @param 	string table
+	 * @param 	array rows
+	 * @param 	array fields
+	 * @param 	array dataTypes
+	 * @return 	boolean
+	 */
+	public function insertMultiple(var table, array! rows, var fields = null, var dataTypes = null) -> boolean
+	{
+		var dialect, row, position, value, bindType, escapedTable, escapedFields, field,
+			placeholders, rowPlaceholders, rowValues, rowTypes, chunks, chunkPlaceholders,
+			chunkValues, chunkTypes, chunk, insertSql, e;
+		int maxRows, maxParams, numberParams;
+		boolean success, transaction;
+
+		if !count(rows) {
+			throw new Exception("Unable to insert into " . table . " without data");
+		}
+
+		let dialect = this->_dialect;
+		if method_exists(dialect, "getMaxInsertRows") {
+			let maxRows = (int) dialect->getMaxInsertRows(),
+				maxParams = (int) dialect->getMaxBindParams();
+		} else {
+			let maxRows = 1000,
+				maxParams = 65535;
+		}
+
+		let chunks = [],
+			chunkPlaceholders = [],
+			chunkValues = [],
+			chunkTypes = [],
+			numberParams = 0;
+
+		/**
+		 * Every row is converted the same way insert() does, then rows are packed in chunks
+		 */
+		for row in rows {
+
+			if typeof row != "array" || !count(row) {
+				throw new Exception("Unable to insert into " . table . " without data");
+			}
+
+			let rowPlaceholders = [],
+				rowValues = [],
+				rowTypes = [];
+
+			for position, value in row {
+				if typeof value == "object" {
+					let rowPlaceholders[] = (string) value;
+				} else {
+					if typeof value == "null" {
+						let rowPlaceholders[] = "null";
+					} else {
+						let rowPlaceholders[] = "?";
+						let rowValues[] = value;
+						if typeof dataTypes == "array" {
+							if !fetch bindType, dataTypes[position] {
+								throw new Exception("Incomplete number of bind types");
+							}
+							let rowTypes[] = bindType;
+						}
+					}
+				}
+			}
+
+			if count(chunkPlaceholders) {
+				if count(chunkPlaceholders) >= maxRows || numberParams + count(rowValues) > maxParams {
+					let chunks[] = [chunkPlaceholders, chunkValues, chunkTypes],
+						chunkPlaceholders = [],
+						chunkValues = [],
+						chunkTypes = [],
+						numberParams = 0;
+				}
+			}
+
+			let chunkPlaceholders[] = rowPlaceholders;
+			for value in rowValues {
+				let chunkValues[] = value;
+			}
+			for bindType in rowTypes {
+				let chunkTypes[] = bindType;
+			}
+			let numberParams += count(rowValues);
+		}
+
+		let chunks[] = [chunkPlaceholders, chunkValues, chunkTypes];
+
+		if globals_get("db.escape_identifiers") {
+			let escapedTable = this->{"escapeIdentifier"}(table);
+		} else {
+			let escapedTable = table;
+		}
+
+		if typeof fields == "array" {
+			if globals_get("db.escape_identifiers") {
+				let escapedFields = [];
+				for field in fields {
+					let escapedFields[] = this->{"escapeIdentifier"}(field);
+				}
+			} else {
+				let escapedFields = fields;
+			}
+		} else {
+			let escapedFields = null;
+		}
+
+		/**
+		 * Several statements are executed atomically
+		 */
+		let transaction = count(chunks) > 1;
+		if transaction {
+			this->{"begin"}();
+		}
+
+		let success = true;
+
+		try {
+
+			for chunk in chunks {
+
+				if method_exists(dialect, "insertMultiple") {
+					let insertSql = dialect->insertMultiple(escapedTable, escapedFields, chunk[0]);
+				} else {
+					let placeholders = [];
+					for rowPlaceholders in chunk[0] {
+						let placeholders[] = "(" . join(", ", rowPlaceholders) . ")";
+					}
+					if typeof escapedFields == "array" {
+						let insertSql = "INSERT INTO " . escapedTable . " (" . join(", ", escapedFields) . ") VALUES " . join(", ", placeholders);
+					} else {
+						let insertSql = "INSERT INTO " . escapedTable . " VALUES " . join(", ", placeholders);
+					}
+				}
+
+				if !count(chunk[2]) {
+					let success = this->{"execute"}(insertSql, chunk[1]);
+				} else {
+					let success = this->{"execute"}(insertSql, chunk[1], chunk[2]);
+				}
+
+				if !success {
+					break;
+				}
+			}
+
+		} catch \Exception, e {
+			if transaction {
+				this->{"rollback"}();
+			}
+			throw e;
+		}
+
+		if transaction {
+			if success {
+				this->{"commit"}();
+			} else {
+				this->{"rollback"}();
+			}
+		}
+
+		return success;
+	}
+
+	/**
+	 * Creates a write batch that buffers rows and inserts them using multi-row INSERT statements
+	 *
+	 * <code>
+	 * $batch = $connection->createBatch("robots", array("name", "year"));
+	 * foreach ($robots as $robot) {
+	 *	 $batch->add(array($robot->name, $robot->year));
+	 * }
+	 * $batch->flush();
+	 * </code>
+	 *
+	 * @param 	string table
+	 * @param 	array fields
+	 * @param 	array dataTypes
+	 * @param 	int size
+	 * @return 	Phalcon\Db\Batch
+	 */
+	public function createBatch(var table, var fields = null, var dataTypes = null, int size = 500) -> <Batch>
+	{
+		return new Batch(this, table, fields, dataTypes, size);
+	}
+
 	/**
 	 * Updates data on a table using custom RBDM SQL syntax
 	 *
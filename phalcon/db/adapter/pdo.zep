@@ -54,6 +54,23 @@ abstract class Pdo extends Adapter
 	 */
 	protected _affectedRows;
 
+	/**
+	 * Maximum number of prepared statements kept per connection, 0 disables the cache
+	 */
+	protected _statementCacheSize = 0;
+
+	/**
+	 * Prepared statements indexed by their SQL, least recently used first
+	 */
+	protected _statementCache;
+
+	/**
+	 * Cached statements currently used by a result
+	 */
+	protected _statementLeases;
+
+	protected _statementCacheStats;
+
 	/**
 	 * Constructor for Phalcon\Db\Adapter\Pdo
 	 */
@@ -86,7 +103,7 @@ abstract class Pdo extends Adapter
 	public function connect(descriptor = null)
 	{
 		var username, password, dsnParts, dsnAttributes,
-			persistent, options, key, value;
+			persistent, options, key, value, statementCacheSize;
 
 		if descriptor === null {
 			let descriptor = this->_descriptor;
@@ -136,6 +153,14 @@ abstract class Pdo extends Adapter
 			unset descriptor["dialectClass"];
 		}
 
+		/**
+		 * Check how many prepared statements must be cached
+		 */
+		if fetch statementCacheSize, descriptor["statementCacheSize"] {
+			let this->_statementCacheSize = (int) statementCacheSize;
+			unset descriptor["statementCacheSize"];
+		}
+
 		/**
 		 * Check if the user has defined a custom dsn
 		 */
@@ -149,12 +174,163 @@ abstract class Pdo extends Adapter
 
 		let options[\Pdo::ATTR_ERRMODE] = \Pdo::ERRMODE_EXCEPTION;
 
+		/**
+		 * Statements prepared by a previous connection can't be reused
+		 */
+		this->clearStatementCache();
+
 		/**
 		 * Create the connection using PDO
 		 */
 		let this->_pdo = new \Pdo(this->_type . ":" . dsnAttributes, username, password, options);
 	}
 
+	/**
+	 * Sets the maximum number of prepared statements cached by the connection (0 disables the cache).
+	 * It also can be passed as the 'statementCacheSize' option in the descriptor
+	 *
+	 *<code>
+	 * $connection->setStatementCacheSize(64);
+	 *</code>
+	 */
+	public function setStatementCacheSize(int size) -> <Pdo>
+	{
+		var statementCache, sqlStatement;
+
+		let this->_statementCacheSize = size,
+			statementCache = this->_statementCache;
+
+		/**
+		 * Evict the least recently used statements that doesn't fit
+		 */
+		if typeof statementCache == "array" {
+			while count(statementCache) > size {
+				for sqlStatement, _ in statementCache {
+					break;
+				}
+				unset statementCache[sqlStatement];
+				let this->_statementCacheStats["evictions"] = this->_statementCacheStats["evictions"] + 1;
+			}
+			let this->_statementCache = statementCache;
+		}
+
+		return this;
+	}
+
+	/**
+	 * Returns the maximum number of prepared statements cached by the connection
+	 */
+	public function getStatementCacheSize() -> int
+	{
+		return this->_statementCacheSize;
+	}
+
+	/**
+	 * Returns the hits, misses and evictions of the prepared statements cache
+	 *
+	 *<code>
+	 * print_r($connection->getStatementCacheStats());
+	 *</code>
+	 */
+	public function getStatementCacheStats() -> array
+	{
+		var stats;
+
+		let stats = this->_statementCacheStats,
+			stats["size"] = count(this->_statementCache);
+		return stats;
+	}
+
+	/**
+	 * Removes the cached prepared statements and resets the statistics
+	 */
+	public function clearStatementCache() -> void
+	{
+		let this->_statementCache = [],
+			this->_statementLeases = [],
+			this->_statementCacheStats = ["hits": 0, "misses": 0, "evictions": 0];
+	}
+
+	/**
+	 * Returns a cached statement used by a result to the cache once the result is released
+	 */
+	public function releaseStatement(string! sqlStatement, <\PDOStatement> statement) -> void
+	{
+		var hash;
+
+		let hash = spl_object_hash(statement);
+		if !isset this->_statementLeases[hash] {
+			return;
+		}
+
+		unset this->_statementLeases[hash];
+
+		statement->closeCursor();
+		this->_cacheStatement(sqlStatement, statement);
+	}
+
+	/**
+	 * Prepares a statement or takes it from the cache. Statements returned to be used by a result
+	 * are leased, they're removed from the cache until the result releases them
+	 */
+	protected function _prepareStatement(string! sqlStatement, boolean lease = false) -> <\PDOStatement> | boolean
+	{
+		var statement;
+
+		if this->_statementCacheSize < 1 {
+			return this->_pdo->prepare(sqlStatement);
+		}
+
+		if fetch statement, this->_statementCache[sqlStatement] {
+
+			let this->_statementCacheStats["hits"] = this->_statementCacheStats["hits"] + 1;
+
+			/**
+			 * Move the statement to the most recently used position
+			 */
+			unset this->_statementCache[sqlStatement];
+			if !lease {
+				let this->_statementCache[sqlStatement] = statement;
+			}
+		} else {
+
+			let this->_statementCacheStats["misses"] = this->_statementCacheStats["misses"] + 1,
+				statement = this->_pdo->prepare(sqlStatement);
+
+			if typeof statement != "object" {
+				return statement;
+			}
+
+			if !lease {
+				this->_cacheStatement(sqlStatement, statement);
+			}
+		}
+
+		if lease {
+			let this->_statementLeases[spl_object_hash(statement)] = true;
+		}
+
+		return statement;
+	}
+
+	/**
+	 * Stores a prepared statement in the cache evicting the least recently used one if it's full
+	 */
+	protected function _cacheStatement(string! sqlStatement, <\PDOStatement> statement) -> void
+	{
+		var key;
+
+		if !isset this->_statementCache[sqlStatement] && count(this->_statementCache) >= this->_statementCacheSize {
+			for key, _ in this->_statementCache {
+				break;
+			}
+			unset this->_statementCache[key];
+			let this->_statementCacheStats["evictions"] = this->_statementCacheStats["evictions"] + 1;
+		}
+
+		let this->_statementCache[sqlStatement] = statement;
+	}
+
 	/**
 	 * Returns a PDO prepared statement to be executed with 'executePrepared'
 	 *
@@ -304,7 +480,7 @@ abstract class Pdo extends Adapter
 
 		let pdo = <\Pdo> this->_pdo;
 		if typeof bindParams == "array" {
-			let statement = pdo->prepare(sqlStatement);
+			let statement = this->_prepareStatement(sqlStatement, true);
 			if typeof statement == "object" {
 				let statement = this->executePrepared(statement, bindParams, bindTypes);
 			}
@@ -359,7 +535,7 @@ abstract class Pdo extends Adapter
 
 		let pdo = <\Pdo> this->_pdo;
 		if typeof bindParams == "array" {
-			let statement = pdo->prepare(sqlStatement);
+			let statement = this->_prepareStatement(sqlStatement);
 			if typeof statement == "object" {
 				let newStatement = this->executePrepared(statement, bindParams, bindTypes),
 					affectedRows = newStatement->rowCount();
@@ -403,6 +579,7 @@ abstract class Pdo extends Adapter
 		var pdo;
 		let pdo = this->_pdo;
 		if typeof pdo == "object" {
+			this->clearStatementCache();
 			let this->_pdo = null;
 		}
 		return true;
@@ -0,0 +1,164 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Db;
+
+use Phalcon\Mvc\Model\TransactionInterface;
+
+/**
+ * Phalcon\Db\Batch
+ *
+ * Buffers rows and writes them using multi-row INSERT statements, the buffer is
+ * flushed automatically every time it reaches the batch size
+ *
+ *<code>
+ *	$batch = new \Phalcon\Db\Batch($connection, "robots", array("name", "year"), null, 1000);
+ *	foreach ($rows as $row) {
+ *		$batch->add(array($row["name"], $row["year"]));
+ *	}
+ *	$batch->flush();
+ *</code>
+ */
+class Batch implements \Countable
+{
+
+	protected _connection;
+
+	protected _table { get };
+
+	protected _fields;
+
+	protected _dataTypes;
+
+	protected _size { get };
+
+	protected _rows;
+
+	protected _transaction;
+
+	protected _insertedRows = 0 { get };
+
+	/**
+	 * Phalcon\Db\Batch constructor
+	 *
+	 * @param Phalcon\Db\Adapter connection
+	 * @param string table
+	 * @param array fields
+	 * @param array dataTypes
+	 * @param int size
+	 */
+	public function __construct(<Adapter> connection, var table, var fields = null, var dataTypes = null, int size = 500)
+	{
+		if size < 1 {
+			throw new Exception("Batch size must be greater than zero");
+		}
+
+		let this->_connection = connection,
+			this->_table = table,
+			this->_fields = fields,
+			this->_dataTypes = dataTypes,
+			this->_size = size,
+			this->_rows = [];
+	}
+
+	/**
+	 * Writes the rows through the connection of a model transaction, the transaction
+	 * is rolled back if any statement fails
+	 */
+	public function setTransaction(<TransactionInterface> transaction) -> <Batch>
+	{
+		var connection;
+
+		let connection = transaction->getConnection();
+		if typeof connection != "object" || !(connection instanceof Adapter) {
+			throw new Exception("The transaction connection doesn't support batched writes");
+		}
+
+		let this->_connection = connection,
+			this->_transaction = transaction;
+		return this;
+	}
+
+	/**
+	 * Returns the model transaction used to write the rows
+	 */
+	public function getTransaction() -> <TransactionInterface> | null
+	{
+		return this->_transaction;
+	}
+
+	/**
+	 * Adds a row to the batch, the batch is flushed when the buffer is full
+	 */
+	public function add(array! values) -> <Batch>
+	{
+		let this->_rows[] = values;
+		if count(this->_rows) >= this->_size {
+			this->flush();
+		}
+		return this;
+	}
+
+	/**
+	 * Returns the number of buffered rows not written yet
+	 */
+	public function count() -> int
+	{
+		return count(this->_rows);
+	}
+
+	/**
+	 * Writes the buffered rows, returns the number of rows written
+	 */
+	public function flush() -> int
+	{
+		var rows, transaction, e;
+		int number;
+		boolean success;
+
+		let rows = this->_rows,
+			number = count(rows);
+
+		if !number {
+			return 0;
+		}
+
+		let this->_rows = [],
+			transaction = this->_transaction;
+
+		try {
+			let success = this->_connection->insertMultiple(this->_table, rows, this->_fields, this->_dataTypes);
+		} catch \Exception, e {
+			if typeof transaction == "object" {
+				transaction->rollback("Batch insert into " . this->_table . " failed: " . e->getMessage());
+			}
+			throw e;
+		}
+
+		if !success {
+			if typeof transaction == "object" {
+				transaction->rollback("Batch insert into " . this->_table . " failed");
+			}
+			throw new Exception("Batch insert into " . this->_table . " failed");
+		}
+
+		let this->_insertedRows += number;
+		return number;
+	}
+}
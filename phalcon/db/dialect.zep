@@ -490,6 +490,51 @@ abstract class Dialect implements DialectInterface
 		return sql;
 	}
 
+	/**
+	 * Generates SQL to insert several rows in a single statement
+	 *
+	 *<code>
+	 * echo $dialect->insertMultiple('"robots"', ['"name"', '"year"'], [['?', '?'], ['?', 'null']]);
+	 * // INSERT INTO "robots" ("name", "year") VALUES (?, ?), (?, null)
+	 *</code>
+	 *
+	 * @param string table
+	 * @param array fields
+	 * @param array rows
+	 * @return string
+	 */
+	public function insertMultiple(string! table, var fields, array! rows) -> string
+	{
+		var values, row;
+
+		let values = [];
+		for row in rows {
+			let values[] = "(" . join(", ", row) . ")";
+		}
+
+		if typeof fields == "array" {
+			return "INSERT INTO " . table . " (" . join(", ", fields) . ") VALUES " . join(", ", values);
+		}
+
+		return "INSERT INTO " . table . " VALUES " . join(", ", values);
+	}
+
+	/**
+	 * Returns the maximum number of rows inserted by a single multi-row INSERT
+	 */
+	public function getMaxInsertRows() -> int
+	{
+		return 1000;
+	}
+
+	/**
+	 * Returns the maximum number of bound parameters in a single statement
+	 */
+	public function getMaxBindParams() -> int
+	{
+		return 65535;
+	}
+
 	/**
 	 * Checks whether the platform supports savepoints
 	 */
@@ -370,6 +370,47 @@ class Oracle extends Dialect
 		return "";
 	}
 
+	/**
+	 * Generates SQL to insert several rows in a single statement using INSERT ALL
+	 *
+	 *<code>
+	 * echo $dialect->insertMultiple('ROBOTS', ['NAME', 'YEAR'], [['?', '?'], ['?', 'null']]);
+	 * // INSERT ALL INTO ROBOTS (NAME, YEAR) VALUES (?, ?) INTO ROBOTS (NAME, YEAR) VALUES (?, null) SELECT 1 FROM DUAL
+	 *</code>
+	 *
+	 * @param string table
+	 * @param array fields
+	 * @param array rows
+	 * @return string
+	 */
+	public function insertMultiple(string! table, var fields, array! rows) -> string
+	{
+		var target, row;
+		string sql;
+
+		if typeof fields == "array" {
+			let target = " INTO " . table . " (" . join(", ", fields) . ") VALUES (";
+		} else {
+			let target = " INTO " . table . " VALUES (";
+		}
+
+		let sql = "INSERT ALL";
+		for row in rows {
+			let sql .= target . join(", ", row) . ")";
+		}
+
+		return sql . " SELECT 1 FROM DUAL";
+	}
+
+	/**
+	 * Returns the maximum number of bound parameters in a single statement,
+	 * INSERT ALL statements can't reference more than 999 columns
+	 */
+	public function getMaxBindParams() -> int
+	{
+		return 999;
+	}
+
 	/**
 	 * Checks whether the platform supports savepoints
 	 */
@@ -38,6 +38,14 @@ class Postgresql extends Dialect
 
 	protected _escapeChar = "\"";
 
+	/**
+	 * Returns the maximum number of bound parameters in a single statement
+	 */
+	public function getMaxBindParams() -> int
+	{
+		return 32767;
+	}
+
 	/**
 	 * Gets the column name in PostgreSQL
 	 */
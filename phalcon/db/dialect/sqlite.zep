@@ -39,6 +39,22 @@ class Sqlite extends Dialect
 
 	protected _escapeChar = "\"";
 
+	/**
+	 * Returns the maximum number of rows inserted by a single multi-row INSERT (SQLITE_MAX_COMPOUND_SELECT)
+	 */
+	public function getMaxInsertRows() -> int
+	{
+		return 500;
+	}
+
+	/**
+	 * Returns the maximum number of bound parameters in a single statement (SQLITE_MAX_VARIABLE_NUMBER)
+	 */
+	public function getMaxBindParams() -> int
+	{
+		return 999;
+	}
+
 	/**
 	 * Gets the column name in SQLite
 	 */
@@ -78,6 +78,13 @@ class Profiler
 	 */
 	protected _totalSeconds = 0;
 
+	/**
+	 * Connection whose prepared statements cache is reported
+	 *
+	 * @var \Phalcon\Db\AdapterInterface
+	 */
+	protected _connection;
+
 	/**
 	 * Starts the profile of a SQL sentence
 	 *
@@ -167,6 +174,43 @@ class Profiler
 		return this;
 	}
 
+	/**
+	 * Sets the profiled connection, its prepared statements cache statistics are returned by getStatementCacheStats()
+	 *
+	 *<code>
+	 *	$profiler->setConnection($connection);
+	 *	print_r($profiler->getStatementCacheStats());
+	 *</code>
+	 */
+	public function setConnection(<AdapterInterface> connection) -> <Profiler>
+	{
+		let this->_connection = connection;
+		return this;
+	}
+
+	/**
+	 * Returns the profiled connection
+	 */
+	public function getConnection() -> <AdapterInterface>
+	{
+		return this->_connection;
+	}
+
+	/**
+	 * Returns the current hits, misses, evictions and size of the prepared statements cache of the profiled connection
+	 */
+	public function getStatementCacheStats() -> array
+	{
+		var connection;
+
+		let connection = this->_connection;
+		if typeof connection == "object" && method_exists(connection, "getStatementCacheStats") {
+			return connection->getStatementCacheStats();
+		}
+
+		return ["hits": 0, "misses": 0, "evictions": 0, "size": 0];
+	}
+
 	/**
 	 * Returns the last profile executed in the profiler
 	 */
@@ -355,4 +355,21 @@ class Pdo implements ResultInterface
 	{
 		return this->_pdoStatement;
 	}
+
+	/**
+	 * Returns the statement to the connection's prepared statements cache
+	 */
+	public function __destruct()
+	{
+		var connection, pdoStatement;
+
+		let connection = this->_connection,
+			pdoStatement = this->_pdoStatement;
+
+		if typeof pdoStatement == "object" && this->_bindParams !== null {
+			if connection instanceof \Phalcon\Db\Adapter\Pdo {
+				connection->releaseStatement(this->_sqlStatement, pdoStatement);
+			}
+		}
+	}
 }
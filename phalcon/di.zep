@@ -26,6 +26,7 @@ use Phalcon\Di\ServiceInterface;
 use Phalcon\Di\Exception;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Di\InjectionAwareInterface;
+use Phalcon\Di\Service\Builder;
 
 /**
  * Phalcon\Di
@@ -83,6 +84,21 @@ class Di implements DiInterface
 	 */
 	protected _eventsManager;
 
+	/**
+	 * Factories of the compiled services
+	 */
+	protected _factories = [];
+
+	/**
+	 * Builder used to run the compiled array definitions
+	 */
+	protected _builder;
+
+	/**
+	 * Reflection of the classes built without a registered service
+	 */
+	protected _reflections = [];
+
 	/**
 	 * Latest DI build
 	 */
@@ -124,6 +140,7 @@ class Di implements DiInterface
 		var service;
 		let service = new Service(name, definition, shared),
 			this->_services[name] = service;
+		unset this->_factories[name];
 		return service;
 	}
 
@@ -135,6 +152,7 @@ class Di implements DiInterface
 		var service;
 		let service = new Service(name, definition, true),
 			this->_services[name] = service;
+		unset this->_factories[name];
 		return service;
 	}
 
@@ -146,6 +164,7 @@ class Di implements DiInterface
 	{
 		unset this->_services[name];
 		unset this->_sharedInstances[name];
+		unset this->_factories[name];
 	}
 
 	/**
@@ -172,6 +191,7 @@ class Di implements DiInterface
 	public function setRaw(string! name, <ServiceInterface> rawDefinition) -> <ServiceInterface>
 	{
 		let this->_services[name] = rawDefinition;
+		unset this->_factories[name];
 		return rawDefinition;
 	}
 
@@ -191,12 +211,14 @@ class Di implements DiInterface
 
 	/**
 	 * Returns a Phalcon\Di\Service instance
+	 * The service may be changed by the caller so it isn't resolved from its compiled factory anymore
 	 */
 	public function getService(string! name) -> <ServiceInterface>
 	{
 		var service;
 
 		if fetch service, this->_services[name] {
+			unset this->_factories[name];
 			return service;
 		}
 
@@ -208,50 +230,99 @@ class Di implements DiInterface
 	 */
 	public function get(string! name, parameters = null) -> var
 	{
-		var service, instance, reflection, eventsManager;
-
-		let eventsManager = <ManagerInterface> this->_eventsManager;
+		var service, instance, reflection, eventsManager, factory;
+		boolean hasListeners;
 
+		/**
+		 * Events are only fired if somebody is listening to them
+		 */
+		let eventsManager = <ManagerInterface> this->_eventsManager,
+			hasListeners = false;
 		if typeof eventsManager == "object" {
+			if method_exists(eventsManager, "hasListeners") {
+				let hasListeners = eventsManager->hasListeners("di")
+					|| eventsManager->hasListeners("di:beforeServiceResolve")
+					|| eventsManager->hasListeners("di:afterServiceResolve");
+			} else {
+				let hasListeners = true;
+			}
+		}
+
+		if hasListeners {
 			eventsManager->fire("di:beforeServiceResolve", this, ["name": name, "parameters": parameters]);
 		}
 
-		if fetch service, this->_services[name] {
-			/**
-			 * The service is registered in the DI
-			 */
-			let instance = service->resolve(parameters, this);
-		} else {
+		if fetch factory, this->_factories[name] {
+
 			/**
-			 * The DI also acts as builder for any class even if it isn't defined in the DI
+			 * The service was compiled, its definition is already known to be valid
 			 */
-			if !class_exists(name) {
-				throw new Exception("Service '" . name . "' wasn't found in the dependency injection container");
+			switch factory[0] {
+
+				case "class":
+					if typeof parameters == "array" && count(parameters) {
+						let instance = create_instance_params(factory[1], parameters);
+					} else {
+						let instance = create_instance(factory[1]);
+					}
+					break;
+
+				case "closure":
+					if typeof parameters == "array" {
+						let instance = call_user_func_array(factory[1], parameters);
+					} else {
+						let instance = call_user_func(factory[1]);
+					}
+					break;
+
+				case "builder":
+					let instance = this->_builder->buildCompiled(this, factory[1], parameters);
+					break;
+
+				default:
+					let instance = factory[1];
 			}
 
-			if typeof parameters == "array" {
-				if count(parameters) {
-					if is_php_version("5.6") {
+		} else {
+
+			if fetch service, this->_services[name] {
+				/**
+				 * The service is registered in the DI
+				 */
+				let instance = service->resolve(parameters, this);
+			} else {
+				/**
+				 * The DI also acts as builder for any class even if it isn't defined in the DI
+				 */
+				if is_php_version("5.6") {
+
+					/**
+					 * The reflection of every class is created only once
+					 */
+					if !fetch reflection, this->_reflections[name] {
+						if !class_exists(name) {
+							throw new Exception("Service '" . name . "' wasn't found in the dependency injection container");
+						}
 						let reflection = new \ReflectionClass(name),
-							instance = reflection->newInstanceArgs(parameters);
+							this->_reflections[name] = reflection;
+					}
+
+					if typeof parameters == "array" && count(parameters) {
+						let instance = reflection->newInstanceArgs(parameters);
 					} else {
-						let instance = create_instance_params(name, parameters);
+						let instance = reflection->newInstance();
 					}
 				} else {
-					if is_php_version("5.6") {
-						let reflection = new \ReflectionClass(name),
-							instance = reflection->newInstance();
+					if !class_exists(name) {
+						throw new Exception("Service '" . name . "' wasn't found in the dependency injection container");
+					}
+
+					if typeof parameters == "array" && count(parameters) {
+						let instance = create_instance_params(name, parameters);
 					} else {
 						let instance = create_instance(name);
 					}
 				}
-			} else {
-				if is_php_version("5.6") {
-					let reflection = new \ReflectionClass(name),
-						instance = reflection->newInstance();
-				} else {
-					let instance = create_instance(name);
-				}
 			}
 		}
 
@@ -264,7 +335,7 @@ class Di implements DiInterface
 			}
 		}
 
-		if typeof eventsManager == "object" {
+		if hasListeners {
 			eventsManager->fire(
 				"di:afterServiceResolve",
 				this,
@@ -279,6 +350,88 @@ class Di implements DiInterface
 		return instance;
 	}
 
+	/**
+	 * Compiles the non-shared services registered so far into a flat table of factories.
+	 * Class names are checked and array definitions are validated only once, later calls to get()
+	 * create the instances without going through Phalcon\Di\Service::resolve().
+	 * Shared services aren't compiled because they are only built once anyway.
+	 * Registering, removing or obtaining a service with getService() drops its compiled factory.
+	 *
+	 *<code>
+	 * $di = new \Phalcon\Di\FactoryDefault();
+	 *
+	 * $di->set("mailer", array(
+	 *     "className" => "App\Mailer",
+	 *     "arguments" => array(
+	 *         array("type" => "service", "name" => "config")
+	 *     )
+	 * ));
+	 *
+	 * $di->compile();
+	 *</code>
+	 */
+	public function compile() -> void
+	{
+		var name, service, definition, factories, builder, e;
+
+		let factories = [],
+			builder = new Builder();
+
+		for name, service in this->_services {
+
+			if !(service instanceof Service) {
+				continue;
+			}
+
+			if service->isShared() {
+				continue;
+			}
+
+			let definition = service->getDefinition();
+
+			if typeof definition == "string" {
+				/**
+				 * Unknown classes are left to Phalcon\Di\Service to report them
+				 */
+				if class_exists(definition) {
+					let factories[name] = ["class", definition];
+				}
+				continue;
+			}
+
+			if typeof definition == "object" {
+				if definition instanceof \Closure {
+					let factories[name] = ["closure", definition];
+				} else {
+					let factories[name] = ["instance", definition];
+				}
+				continue;
+			}
+
+			if typeof definition == "array" {
+				/**
+				 * Invalid definitions keep throwing when they are resolved, not when compiled
+				 */
+				try {
+					let factories[name] = ["builder", builder->compile(definition)];
+				} catch Exception, e {
+					continue;
+				}
+			}
+		}
+
+		let this->_factories = factories,
+			this->_builder = builder;
+	}
+
+	/**
+	 * Check whether a service is resolved from a compiled factory
+	 */
+	public function isCompiled(string! name) -> boolean
+	{
+		return isset this->_factories[name];
+	}
+
 	/**
 	 * Resolves a service, the resolved service is stored in the DI, subsequent requests for this service will return the same instance
 	 *
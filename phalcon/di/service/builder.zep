@@ -280,4 +280,248 @@ class Builder
 
 		return instance;
 	}
+
+	/**
+	 * Validates a constructor/call parameter once and returns its plan
+	 */
+	private function _compileParameter(int position, array! argument) -> array
+	{
+		var type, name, value, instanceArguments;
+
+		if !fetch type, argument["type"] {
+			throw new Exception("Argument at position " . position . " must have a type");
+		}
+
+		switch type {
+
+			case "service":
+				if !fetch name, argument["name"] {
+					throw new Exception("Service 'name' is required in parameter on position " . position);
+				}
+				return [1, name, null];
+
+			case "parameter":
+				if !fetch value, argument["value"] {
+					throw new Exception("Service 'value' is required in parameter on position " . position);
+				}
+				return [2, value, null];
+
+			case "instance":
+				if !fetch name, argument["className"] {
+					throw new Exception("Service 'className' is required in parameter on position " . position);
+				}
+				if fetch instanceArguments, argument["arguments"] {
+					return [3, name, instanceArguments];
+				}
+				return [3, name, null];
+
+			default:
+				throw new Exception("Unknown service type in parameter on position " . position);
+		}
+	}
+
+	/**
+	 * Validates an array of parameters once and returns their plans
+	 */
+	private function _compileParameters(array! arguments) -> array
+	{
+		var position, argument, plans;
+
+		let plans = [];
+		for position, argument in arguments {
+			if typeof argument != "array" {
+				throw new Exception("Argument at position " . position . " must be an array");
+			}
+			let plans[] = this->_compileParameter(position, argument);
+		}
+		return plans;
+	}
+
+	/**
+	 * Resolves a parameter plan produced by _compileParameter()
+	 */
+	private function _resolveParameter(<DiInterface> dependencyInjector, array! plan)
+	{
+		var instanceArguments;
+
+		switch plan[0] {
+
+			case 1:
+				return dependencyInjector->get(plan[1]);
+
+			case 2:
+				return plan[1];
+		}
+
+		let instanceArguments = plan[2];
+		if instanceArguments !== null {
+			return dependencyInjector->get(plan[1], instanceArguments);
+		}
+		return dependencyInjector->get(plan[1]);
+	}
+
+	/**
+	 * Resolves an array of parameter plans
+	 */
+	private function _resolveParameters(<DiInterface> dependencyInjector, array! plans) -> array
+	{
+		var plan, buildArguments;
+
+		let buildArguments = [];
+		for plan in plans {
+			let buildArguments[] = this->_resolveParameter(dependencyInjector, plan);
+		}
+		return buildArguments;
+	}
+
+	/**
+	 * Validates a complex service definition and returns a plan for buildCompiled().
+	 * The definition is walked and checked only here, any invalid part of it throws
+	 * a Phalcon\Di\Exception
+	 *
+	 * @param array definition
+	 * @return array
+	 */
+	public function compile(array! definition) -> array
+	{
+		var className, arguments, paramCalls, methodPosition, method, methodName,
+			callArguments, calls, propertyPosition, property, propertyName, propertyValue, properties;
+
+		if !fetch className, definition["className"] {
+			throw new Exception("Invalid service definition. Missing 'className' parameter");
+		}
+
+		if fetch arguments, definition["arguments"] {
+			if typeof arguments != "array" {
+				throw new Exception("Constructor arguments must be an array");
+			}
+			let arguments = this->_compileParameters(arguments);
+		} else {
+			let arguments = null;
+		}
+
+		let calls = [];
+		if fetch paramCalls, definition["calls"] {
+
+			if typeof paramCalls != "array" {
+				throw new Exception("Setter injection parameters must be an array");
+			}
+
+			for methodPosition, method in paramCalls {
+
+				if typeof method != "array" {
+					throw new Exception("Method call must be an array on position " . methodPosition);
+				}
+
+				if !fetch methodName, method["method"] {
+					throw new Exception("The method name is required on position " . methodPosition);
+				}
+
+				if fetch callArguments, method["arguments"] {
+					if typeof callArguments != "array" {
+						throw new Exception("Call arguments must be an array " . methodPosition);
+					}
+					if count(callArguments) {
+						let calls[] = [methodName, this->_compileParameters(callArguments)];
+						continue;
+					}
+				}
+
+				let calls[] = [methodName, null];
+			}
+		}
+
+		let properties = [];
+		if fetch paramCalls, definition["properties"] {
+
+			if typeof paramCalls != "array" {
+				throw new Exception("Setter injection parameters must be an array");
+			}
+
+			for propertyPosition, property in paramCalls {
+
+				if typeof property != "array" {
+					throw new Exception("Property must be an array on position " . propertyPosition);
+				}
+
+				if !fetch propertyName, property["name"] {
+					throw new Exception("The property name is required on position " . propertyPosition);
+				}
+
+				if !fetch propertyValue, property["value"] {
+					throw new Exception("The property value is required on position " . propertyPosition);
+				}
+
+				if typeof propertyValue != "array" {
+					throw new Exception("The property value must be an array on position " . propertyPosition);
+				}
+
+				let properties[] = [propertyName, this->_compileParameter(propertyPosition, propertyValue)];
+			}
+		}
+
+		return [className, arguments, calls, properties];
+	}
+
+	/**
+	 * Builds a service from a plan returned by compile()
+	 *
+	 * @param \Phalcon\DiInterface dependencyInjector
+	 * @param array plan
+	 * @param array parameters
+	 * @return mixed
+	 */
+	public function buildCompiled(<DiInterface> dependencyInjector, array! plan, parameters = null)
+	{
+		var className, arguments, calls, call, properties, property, propertyName, instance;
+
+		let className = plan[0];
+
+		if typeof parameters == "array" {
+			if count(parameters) {
+				let instance = create_instance_params(className, parameters);
+			} else {
+				let instance = create_instance(className);
+			}
+		} else {
+			let arguments = plan[1];
+			if arguments !== null {
+				let instance = create_instance_params(className, this->_resolveParameters(dependencyInjector, arguments));
+			} else {
+				let instance = create_instance(className);
+			}
+		}
+
+		let calls = plan[2];
+		if count(calls) {
+
+			if typeof instance != "object" {
+				throw new Exception("The definition has setter injection parameters but the constructor didn't return an instance");
+			}
+
+			for call in calls {
+				let arguments = call[1];
+				if arguments !== null {
+					call_user_func_array([instance, call[0]], this->_resolveParameters(dependencyInjector, arguments));
+				} else {
+					call_user_func([instance, call[0]]);
+				}
+			}
+		}
+
+		let properties = plan[3];
+		if count(properties) {
+
+			if typeof instance != "object" {
+				throw new Exception("The definition has properties injection parameters but the constructor didn't return an instance");
+			}
+
+			for property in properties {
+				let propertyName = property[0],
+					instance->{propertyName} = this->_resolveParameter(dependencyInjector, property[1]);
+			}
+		}
+
+		return instance;
+	}
 }
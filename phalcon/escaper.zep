@@ -156,6 +156,17 @@ class Escaper implements EscaperInterface
 	 */
 	public function escapeCss(string css) -> string
 	{
+		var escaped;
+
+		/**
+		 * ASCII strings are escaped without converting them to UTF-32,
+		 * they are returned as they are if nothing needs to be escaped
+		 */
+		let escaped = phalcon_escape_css_ascii(css);
+		if typeof escaped == "string" {
+			return escaped;
+		}
+
 		/**
 		 * Normalize encoding to UTF-32
 		 * Escape the string
@@ -168,6 +179,17 @@ class Escaper implements EscaperInterface
 	 */
 	public function escapeJs(string js) -> string
 	{
+		var escaped;
+
+		/**
+		 * ASCII strings are escaped without converting them to UTF-32,
+		 * they are returned as they are if nothing needs to be escaped
+		 */
+		let escaped = phalcon_escape_js_ascii(js);
+		if typeof escaped == "string" {
+			return escaped;
+		}
+
 		/**
 		 * Normalize encoding to UTF-32
 		 * Escape the string
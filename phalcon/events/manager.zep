@@ -41,6 +41,13 @@ class Manager implements ManagerInterface
 
 	protected _responses;
 
+	/**
+	 * Listeners of every fired event type, sorted by priority and indexed by the full event type
+	 */
+	protected _dispatchTable;
+
+	protected _statistics;
+
 	/**
 	 * Attach a listener to the events manager
 	 *
@@ -74,6 +81,9 @@ class Manager implements ManagerInterface
 			}
 		}
 
+		// The dispatch table must be rebuilt
+		let this->_dispatchTable = null;
+
 		// Insert the handler in the queue
 		if typeof priorityQueue == "object" {
 			priorityQueue->insert(handler, priority);
@@ -101,6 +111,9 @@ class Manager implements ManagerInterface
 
 		if fetch priorityQueue, this->_events[eventType] {
 
+			// The dispatch table must be rebuilt
+			let this->_dispatchTable = null;
+
 			if typeof priorityQueue == "object" {
 
 				// SplPriorityQueue hasn't method for element deletion, so we need to rebuild queue
@@ -134,7 +147,8 @@ class Manager implements ManagerInterface
 	 */
 	public function enablePriorities(boolean enablePriorities)
 	{
-		let this->_enablePriorities = enablePriorities;
+		let this->_enablePriorities = enablePriorities,
+			this->_dispatchTable = null;
 	}
 
 	/**
@@ -178,6 +192,8 @@ class Manager implements ManagerInterface
 	 */
 	public function detachAll(string! type = null)
 	{
+		let this->_dispatchTable = null;
+
 		if type === null {
 			let this->_events = null;
 		} else {
@@ -381,22 +397,18 @@ class Manager implements ManagerInterface
 	 */
 	public function fire(string! eventType, source, data = null, boolean cancelable = true)
 	{
-		var events, eventParts, type, eventName, event, status, fireEvents;
+		var events, dispatch, fireEvents, event, status, start, counters;
 
 		let events = this->_events;
 		if typeof events != "array" {
 			return null;
 		}
 
-		// All valid events must have a colon separator
-		if !memstr(eventType, ":") {
-			throw new Exception("Invalid event type " . eventType);
+		// Event types are split and their listeners sorted only the first time they're fired
+		if !fetch dispatch, this->_dispatchTable[eventType] {
+			let dispatch = this->_compileDispatch(eventType);
 		}
 
-		let eventParts = explode(":", eventType),
-			type = eventParts[0],
-			eventName = eventParts[1];
-
 		let status = null;
 
 		// Responses must be traced?
@@ -404,39 +416,153 @@ class Manager implements ManagerInterface
 			let this->_responses = null;
 		}
 
+		if typeof this->_statistics == "array" {
+			let start = microtime(true);
+		}
+
 		let event = null;
 
 		// Check if events are grouped by type
-		if fetch fireEvents, events[type] {
+		let fireEvents = dispatch[1];
+		if fireEvents !== null {
 
-			if typeof fireEvents == "object" || typeof fireEvents == "array" {
+			// Create the event context
+			let event = new Event(dispatch[0], source, data, cancelable);
 
-				// Create the event context
-				let event = new Event(eventName, source, data, cancelable);
+			// Call the events queue
+			let status = this->fireQueue(fireEvents, event);
+		}
 
-				// Call the events queue
-				let status = this->fireQueue(fireEvents, event);
+		// Check if there are listeners for the event type itself
+		let fireEvents = dispatch[2];
+		if fireEvents !== null {
 
+			// Create the event if it wasn't created before
+			if event === null {
+				let event = new Event(dispatch[0], source, data, cancelable);
 			}
+
+			// Call the events queue
+			let status = this->fireQueue(fireEvents, event);
 		}
 
-		// Check if there are listeners for the event type itself
-		if fetch fireEvents, events[eventType] {
+		// Update the counters of the event type
+		if typeof this->_statistics == "array" {
+			if !fetch counters, this->_statistics[eventType] {
+				let counters = ["fired": 0, "listeners": 0, "time": 0.0];
+			}
+			let counters["fired"] = counters["fired"] + 1,
+				counters["listeners"] = counters["listeners"] + dispatch[3],
+				counters["time"] = counters["time"] + microtime(true) - start;
+			let this->_statistics[eventType] = counters;
+		}
 
-			if typeof fireEvents == "object" || typeof fireEvents == "array" {
+		return status;
+	}
 
-				// Create the event if it wasn't created before
-				if event === null {
-					let event = new Event(eventName, source, data, cancelable);
-				}
+	/**
+	 * Splits an event type and builds the arrays of listeners attached to its type and
+	 * to the event type itself, sorted by priority. The result is stored in the dispatch table
+	 */
+	protected function _compileDispatch(string! eventType) -> array
+	{
+		var eventParts, typeListeners, eventListeners, dispatch;
+		int number;
+
+		// All valid events must have a colon separator
+		if !memstr(eventType, ":") {
+			throw new Exception("Invalid event type " . eventType);
+		}
+
+		let eventParts = explode(":", eventType),
+			typeListeners = this->_getSortedListeners(eventParts[0]),
+			eventListeners = this->_getSortedListeners(eventType),
+			number = 0;
+
+		if typeListeners !== null {
+			let number += count(typeListeners);
+		}
+
+		if eventListeners !== null {
+			let number += count(eventListeners);
+		}
+
+		let dispatch = [eventParts[1], typeListeners, eventListeners, number],
+			this->_dispatchTable[eventType] = dispatch;
+
+		return dispatch;
+	}
+
+	/**
+	 * Returns the listeners attached to a type as an array sorted by priority or null if there are no listeners
+	 *
+	 * @return array|null
+	 */
+	protected function _getSortedListeners(string! type)
+	{
+		var queue, iterator, listeners;
+
+		if !fetch queue, this->_events[type] {
+			return null;
+		}
+
+		if typeof queue == "object" {
+
+			if !count(queue) {
+				return null;
+			}
 
-				// Call the events queue
-				let status = this->fireQueue(fireEvents, event);
+			// The queue is cloned to keep the original intact
+			let iterator = clone queue,
+				listeners = [];
+
+			iterator->top();
+			while iterator->valid() {
+				let listeners[] = iterator->current();
+				iterator->next();
 			}
 
+			return listeners;
 		}
 
-		return status;
+		if typeof queue != "array" || !count(queue) {
+			return null;
+		}
+
+		return queue;
+	}
+
+	/**
+	 * Enables or disables the counters of fired events, notified listeners and time spent by event type
+	 */
+	public function enableStatistics(boolean enable) -> <Manager>
+	{
+		if enable {
+			if typeof this->_statistics != "array" {
+				let this->_statistics = [];
+			}
+		} else {
+			let this->_statistics = null;
+		}
+		return this;
+	}
+
+	/**
+	 * Returns the counters of fired events indexed by event type
+	 *
+	 *<code>
+	 *	$eventsManager->enableStatistics(true);
+	 *	// ...
+	 *	print_r($eventsManager->getStatistics());
+	 *	// ['db:beforeQuery' => ['fired' => 12, 'listeners' => 12, 'time' => 0.0021], ...]
+	 *</code>
+	 */
+	public function getStatistics() -> array
+	{
+		if typeof this->_statistics == "array" {
+			return this->_statistics;
+		}
+		return [];
 	}
 
 	/**
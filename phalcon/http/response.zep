@@ -55,6 +55,16 @@ class Response implements ResponseInterface, InjectionAwareInterface
 
 	protected _file;
 
+	protected _stream;
+
+	protected _chunkSize = 8192;
+
+	protected _sendfile;
+
+	protected _sendfilePath;
+
+	protected _sendfileUri;
+
 	protected _dependencyInjector;
 
 	/**
@@ -571,12 +581,22 @@ class Response implements ResponseInterface, InjectionAwareInterface
 	 */
 	public function send() -> <Response>
 	{
-		var headers, cookies, content, file;
+		var content, file, range;
 
 		if this->_sent {
 			throw new Exception("Response was already sent");
 		}
 
+		/**
+		 * Files may change the status and the headers, so they are checked before sending them
+		 */
+		let content = this->_content,
+			file = this->_file,
+			range = null;
+		if content == null && this->_stream === null && typeof file == "string" && strlen(file) {
+			let range = this->_prepareFile(file);
+		}
+
 		this->sendHeaders();
 
 		this->sendCookies();
@@ -584,14 +604,19 @@ class Response implements ResponseInterface, InjectionAwareInterface
 		/**
 		 * Output the response body
 		 */
-		let content = this->_content;
 		if content != null {
 			echo content;
 		} else {
-			let file = this->_file;
-
-			if typeof file == "string" && strlen(file) {
-				readfile(file);
+			if this->_stream !== null {
+				this->_sendStream();
+			} else {
+				if typeof range == "array" {
+					this->_sendFile(file, range[0], range[1]);
+				} else {
+					if range === null && typeof file == "string" && strlen(file) {
+						readfile(file);
+					}
+				}
 			}
 		}
 
@@ -600,7 +625,9 @@ class Response implements ResponseInterface, InjectionAwareInterface
 	}
 
 	/**
-	 * Sets an attached file to be sent at the end of the request
+	 * Sets an attached file to be sent at the end of the request.
+	 * The file is sent with ETag/Last-Modified validators, honoring If-None-Match, If-Modified-Since
+	 * and single byte ranges (206). See setSendfile() to let the web server send it
 	 *
 	 * @param string filePath
 	 * @param string attachmentName
@@ -627,4 +654,225 @@ class Response implements ResponseInterface, InjectionAwareInterface
 
 		return this;
 	}
+
+	/**
+	 * Offloads the files set with setFileToSend() to the web server using a header like
+	 * X-Sendfile (Apache, lighttpd) or X-Accel-Redirect (nginx). Paths under basePath are
+	 * translated to baseUri, as nginx expects an internal location instead of a path
+	 *
+	 *<code>
+	 *	$response->setSendfile("X-Sendfile");
+	 *	$response->setSendfile("X-Accel-Redirect", "/var/www/storage/", "/protected/");
+	 *</code>
+	 */
+	public function setSendfile(string! header, string basePath = null, string baseUri = null) -> <Response>
+	{
+		let this->_sendfile = header,
+			this->_sendfilePath = basePath,
+			this->_sendfileUri = baseUri;
+		return this;
+	}
+
+	/**
+	 * Sets a body that is sent in chunks, flushing the output after each one, instead of being kept in memory.
+	 * The stream is an array or a Traversable yielding the chunks, or a callable that either returns one
+	 * (e.g. a generator) or prints the body itself. Output buffers started by the application aren't flushed,
+	 * end them before sending the response to stream the chunks to the client
+	 *
+	 *<code>
+	 *	$response->setStream(function () use ($db) {
+	 *		foreach ($db->query("SELECT * FROM robots") as $robot) {
+	 *			yield implode(",", $robot) . PHP_EOL;
+	 *		}
+	 *	});
+	 *</code>
+	 */
+	public function setStream(var stream, int chunkSize = 8192) -> <Response>
+	{
+		if typeof stream != "array" && !(stream instanceof \Traversable) && !is_callable(stream) {
+			throw new Exception("The stream must be an array, a Traversable or a callable");
+		}
+
+		let this->_stream = stream,
+			this->_chunkSize = chunkSize;
+		return this;
+	}
+
+	/**
+	 * Returns the body set with setStream()
+	 */
+	public function getStream() -> var
+	{
+		return this->_stream;
+	}
+
+	/**
+	 * Outputs the stream, small chunks are coalesced up to the chunk size before flushing
+	 */
+	protected function _sendStream() -> void
+	{
+		var stream, chunk, buffer;
+		int chunkSize;
+
+		let stream = this->_stream;
+		if typeof stream != "array" && !(stream instanceof \Traversable) {
+			let stream = call_user_func(stream);
+			if typeof stream != "array" && !(stream instanceof \Traversable) {
+				this->_flush();
+				return;
+			}
+		}
+
+		let chunkSize = this->_chunkSize,
+			buffer = "";
+		for chunk in stream {
+			let buffer .= chunk;
+			if strlen(buffer) >= chunkSize {
+				echo buffer;
+				this->_flush();
+				let buffer = "";
+			}
+		}
+
+		if buffer !== "" {
+			echo buffer;
+		}
+		this->_flush();
+	}
+
+	/**
+	 * Pushes the output to the client, output buffers opened by the application are left untouched
+	 */
+	protected function _flush() -> void
+	{
+		flush();
+	}
+
+	/**
+	 * Sets the validators, status and length of a file response.
+	 * Returns the offset and length to send, false if there is no body to send
+	 * and null if the file can't be read
+	 */
+	protected function _prepareFile(string file) -> array | boolean | null
+	{
+		var headers, size, mtime, etag, lastModified, match, since, range, ifRange, matches,
+			start, end, path, location;
+
+		if !is_file(file) {
+			return null;
+		}
+
+		let headers = this->getHeaders(),
+			size = filesize(file),
+			mtime = filemtime(file);
+
+		let etag = headers->get("Etag");
+		if etag === false {
+			let etag = "\"" . dechex(mtime) . "-" . dechex(size) . "\"";
+			headers->set("Etag", etag);
+		}
+
+		let lastModified = headers->get("Last-Modified");
+		if lastModified === false {
+			let lastModified = gmdate("D, d M Y H:i:s", mtime) . " GMT";
+			headers->set("Last-Modified", lastModified);
+		}
+
+		/**
+		 * Conditional requests
+		 */
+		if fetch match, _SERVER["HTTP_IF_NONE_MATCH"] {
+			if match == "*" || in_array(etag, preg_split("/\\s*,\\s*/", trim(match))) {
+				this->setNotModified();
+				return false;
+			}
+		} else {
+			if fetch since, _SERVER["HTTP_IF_MODIFIED_SINCE"] {
+				if strtotime(since) >= mtime {
+					this->setNotModified();
+					return false;
+				}
+			}
+		}
+
+		/**
+		 * The web server sends the file and handles the ranges itself
+		 */
+		if this->_sendfile {
+			let path = realpath(file),
+				location = path;
+			if this->_sendfilePath && this->_sendfileUri && starts_with(path, this->_sendfilePath) {
+				let location = this->_sendfileUri . substr(path, strlen(this->_sendfilePath));
+			}
+			headers->set(this->_sendfile, location);
+			return false;
+		}
+
+		headers->set("Accept-Ranges", "bytes");
+
+		/**
+		 * Only single byte ranges are honored, anything else gets the whole file
+		 */
+		if fetch range, _SERVER["HTTP_RANGE"] {
+
+			if fetch ifRange, _SERVER["HTTP_IF_RANGE"] {
+				if ifRange != etag && ifRange != lastModified {
+					let range = null;
+				}
+			}
+
+			let matches = null;
+			if range && preg_match("/^bytes=(\\d*)-(\\d*)$/", trim(range), matches) && (matches[1] !== "" || matches[2] !== "") {
+
+				if matches[1] === "" {
+					let start = max(size - (int) matches[2], 0),
+						end = size - 1;
+				} else {
+					let start = (int) matches[1];
+					if matches[2] === "" {
+						let end = size - 1;
+					} else {
+						let end = min((int) matches[2], size - 1);
+					}
+				}
+
+				if start > end || start >= size {
+					this->setStatusCode(416);
+					headers->set("Content-Range", "bytes */" . size);
+					return false;
+				}
+
+				this->setStatusCode(206);
+				headers->set("Content-Range", "bytes " . start . "-" . end . "/" . size);
+				headers->set("Content-Length", end - start + 1);
+				return [start, end - start + 1];
+			}
+		}
+
+		headers->set("Content-Length", size);
+		return [0, size];
+	}
+
+	/**
+	 * Outputs a part of a file without reading it in memory
+	 */
+	protected function _sendFile(string file, int offset, int length) -> void
+	{
+		var handle, output;
+
+		if offset == 0 && length == filesize(file) {
+			readfile(file);
+			return;
+		}
+
+		let handle = fopen(file, "rb");
+		if handle === false {
+			return;
+		}
+
+		let output = fopen("php://output", "wb");
+		stream_copy_to_stream(handle, output, length, offset);
+		fclose(output);
+		fclose(handle);
+	}
 }
@@ -19,6 +19,8 @@
 
 namespace Phalcon;
 
+use Phalcon\Loader\Exception;
+use Phalcon\Cache\BackendInterface;
 use Phalcon\Events\ManagerInterface;
 use Phalcon\Events\EventsAwareInterface;
 
@@ -66,6 +68,18 @@ class Loader implements EventsAwareInterface
 
 	protected _registered = false;
 
+	protected _authoritative = false;
+
+	protected _lookupCache = null;
+
+	protected _numberLookups = 0;
+
+	protected _numberStats = 0;
+
+	protected _numberHits = 0;
+
+	protected _numberCacheHits = 0;
+
 	/**
 	 * Phalcon\Loader constructor
 	 */
@@ -226,6 +240,231 @@ class Loader implements EventsAwareInterface
 		return this->_classes;
 	}
 
+	/**
+	 * Sets if the classes registered with registerClasses() are the only ones that can be loaded,
+	 * in authoritative mode the filesystem is never checked for unknown classes
+	 *
+	 *<code>
+	 * $loader->registerClasses(require 'app/cache/classmap.php');
+	 * $loader->setAuthoritative(true);
+	 *</code>
+	 */
+	public function setAuthoritative(boolean authoritative) -> <Loader>
+	{
+		let this->_authoritative = authoritative;
+		return this;
+	}
+
+	/**
+	 * Checks if the loader is in authoritative mode
+	 */
+	public function isAuthoritative() -> boolean
+	{
+		return this->_authoritative;
+	}
+
+	/**
+	 * Sets a cache backend to store the paths found and the classes not found across requests.
+	 * A shared memory backend like Apc or Xcache is recommended, the cache must be flushed when
+	 * new classes are deployed
+	 */
+	public function setLookupCache(<BackendInterface> lookupCache = null) -> <Loader>
+	{
+		let this->_lookupCache = lookupCache;
+		return this;
+	}
+
+	/**
+	 * Returns the cache backend used to store the lookups
+	 */
+	public function getLookupCache() -> <BackendInterface> | null
+	{
+		return this->_lookupCache;
+	}
+
+	/**
+	 * Returns the number of classes looked up, filesystem checks performed, classes found
+	 * and lookups resolved by the lookup cache
+	 */
+	public function getStatistics() -> array
+	{
+		return [
+			"lookups":   this->_numberLookups,
+			"stats":     this->_numberStats,
+			"hits":      this->_numberHits,
+			"cacheHits": this->_numberCacheHits
+		];
+	}
+
+	/**
+	 * Scans the registered namespaces, prefixes and directories returning a map of every
+	 * class, interface and trait declared in them with the file that declares it.
+	 * If a path is passed the map is written to it as a PHP file
+	 *
+	 *<code>
+	 * // At deploy time
+	 * $loader->dumpClassMap('app/cache/classmap.php');
+	 *
+	 * // In the bootstrap
+	 * $loader->registerClasses(require 'app/cache/classmap.php')->setAuthoritative(true);
+	 *</code>
+	 */
+	public function dumpClassMap(string path = null) -> array
+	{
+		var directories, directory, extensions, classMap, iterator, file, filePath, className;
+
+		let directories = [];
+
+		if typeof this->_namespaces == "array" {
+			for directory in this->_namespaces {
+				let directories[] = directory;
+			}
+		}
+
+		if typeof this->_prefixes == "array" {
+			for directory in this->_prefixes {
+				let directories[] = directory;
+			}
+		}
+
+		if typeof this->_directories == "array" {
+			for directory in this->_directories {
+				let directories[] = directory;
+			}
+		}
+
+		let extensions = this->_extensions,
+			classMap = [];
+
+		/**
+		 * Directories are scanned in the same order used by autoLoad()
+		 */
+		for directory in directories {
+
+			if !is_dir(directory) {
+				continue;
+			}
+
+			let iterator = new \RecursiveIteratorIterator(new \RecursiveDirectoryIterator(directory, \FilesystemIterator::SKIP_DOTS));
+			for file in iterator {
+
+				if !in_array(file->getExtension(), extensions) {
+					continue;
+				}
+
+				let filePath = file->getPathname();
+				for className in this->_getDeclaredClasses(filePath) {
+					if !isset classMap[className] {
+						let classMap[className] = filePath;
+					}
+				}
+			}
+		}
+
+		if path !== null {
+			if file_put_contents(path, "<?php return " . var_export(classMap, true) . "; ") === false {
+				throw new Exception("Class map file " . path . " cannot be written");
+			}
+		}
+
+		return classMap;
+	}
+
+	/**
+	 * Returns the classes, interfaces and traits declared in a file
+	 */
+	protected function _getDeclaredClasses(string! filePath) -> array
+	{
+		var tokens, token, nextToken, classes, namespaceName, previous;
+		int position, next, total;
+
+		let tokens = token_get_all(file_get_contents(filePath)),
+			total = count(tokens),
+			classes = [],
+			namespaceName = "",
+			previous = null,
+			position = 0;
+
+		while position < total {
+
+			let token = tokens[position],
+				position++;
+
+			if typeof token != "array" {
+				let previous = token;
+				continue;
+			}
+
+			if token[0] == T_WHITESPACE || token[0] == T_COMMENT || token[0] == T_DOC_COMMENT {
+				continue;
+			}
+
+			if token[0] == T_NAMESPACE {
+
+				/**
+				 * The namespace name ends with a semicolon or an opening brace
+				 */
+				let namespaceName = "";
+				while position < total {
+					let nextToken = tokens[position];
+					if typeof nextToken != "array" {
+						break;
+					}
+					if nextToken[0] == T_STRING || nextToken[0] == T_NS_SEPARATOR {
+						let namespaceName .= nextToken[1];
+					}
+					let position++;
+				}
+
+				if namespaceName != "" {
+					let namespaceName .= "\\";
+				}
+
+			} else {
+
+				/**
+				 * Class constants like Robots::class are not declarations
+				 */
+				if (token[0] == T_CLASS || token[0] == T_INTERFACE || token[0] == T_TRAIT) && !(typeof previous == "array" && previous[0] == T_DOUBLE_COLON) {
+
+					let next = position;
+					while next < total {
+						let nextToken = tokens[next],
+							next++;
+						if typeof nextToken == "array" {
+							if nextToken[0] == T_STRING {
+								let classes[] = namespaceName . nextToken[1];
+								break;
+							}
+							if nextToken[0] != T_WHITESPACE {
+								break;
+							}
+						} else {
+							break;
+						}
+					}
+				}
+			}
+
+			let previous = token;
+		}
+
+		return classes;
+	}
+
+	/**
+	 * Stores the result of a lookup in the lookup cache
+	 */
+	protected function _cacheLookup(string! className, string! filePath) -> void
+	{
+		var lookupCache;
+
+		let lookupCache = this->_lookupCache;
+		if typeof lookupCache == "object" {
+			lookupCache->save("loader-" . className, filePath, null, false);
+		}
+	}
+
 	/**
 	 * Register the autoload method
 	 */
@@ -257,7 +496,10 @@ class Loader implements EventsAwareInterface
 	{
 		var eventsManager, classes, extensions, filePath, ds, fixedDirectory,
 			prefixes, directories, namespaceSeparator, namespaces, nsPrefix,
-			directory, fileName, extension, prefix, dsClassName, nsClassName;
+			directory, fileName, extension, prefix, dsClassName, nsClassName,
+			lookupCache;
+
+		let this->_numberLookups++;
 
 		let eventsManager = this->_eventsManager;
 		if typeof eventsManager == "object" {
@@ -274,6 +516,45 @@ class Loader implements EventsAwareInterface
 					let this->_foundPath = filePath;
 					eventsManager->fire("loader:pathFound", this, filePath);
 				}
+				let this->_numberHits++;
+				require filePath;
+				return true;
+			}
+		}
+
+		/**
+		 * In authoritative mode only the registered classes can be loaded
+		 */
+		if this->_authoritative {
+			if typeof eventsManager == "object" {
+				eventsManager->fire("loader:afterCheckClass", this, className);
+			}
+			return false;
+		}
+
+		/**
+		 * Check the paths found and the classes not found in previous requests,
+		 * an empty path means that the class couldn't be found
+		 */
+		let lookupCache = this->_lookupCache;
+		if typeof lookupCache == "object" {
+			let filePath = lookupCache->get("loader-" . className);
+			if typeof filePath == "string" {
+
+				let this->_numberCacheHits++;
+
+				if filePath === "" {
+					if typeof eventsManager == "object" {
+						eventsManager->fire("loader:afterCheckClass", this, className);
+					}
+					return false;
+				}
+
+				if typeof eventsManager == "object" {
+					let this->_foundPath = filePath;
+					eventsManager->fire("loader:pathFound", this, filePath);
+				}
+				let this->_numberHits++;
 				require filePath;
 				return true;
 			}
@@ -325,6 +606,7 @@ class Loader implements EventsAwareInterface
 							/**
 							 * This is probably a good path, let's check if the file exists
 							 */
+							let this->_numberStats++;
 							if is_file(filePath) {
 
 								if typeof eventsManager == "object" {
@@ -332,6 +614,9 @@ class Loader implements EventsAwareInterface
 									eventsManager->fire("loader:pathFound", this, filePath);
 								}
 
+								let this->_numberHits++;
+								this->_cacheLookup(className, filePath);
+
 								/**
 								 * Simulate a require
 								 */
@@ -384,6 +669,7 @@ class Loader implements EventsAwareInterface
 								eventsManager->fire("loader:beforeCheckPath", this, filePath);
 							}
 
+							let this->_numberStats++;
 							if is_file(filePath) {
 
 								/**
@@ -394,6 +680,9 @@ class Loader implements EventsAwareInterface
 									eventsManager->fire("loader:pathFound", this, filePath);
 								}
 
+								let this->_numberHits++;
+								this->_cacheLookup(className, filePath);
+
 								require filePath;
 								return true;
 							}
@@ -441,6 +730,7 @@ class Loader implements EventsAwareInterface
 					/**
 					 * Check in every directory if the class exists here
 					 */
+					let this->_numberStats++;
 					if is_file(filePath) {
 
 						/**
@@ -451,6 +741,9 @@ class Loader implements EventsAwareInterface
 							eventsManager->fire("loader:pathFound", this, filePath);
 						}
 
+						let this->_numberHits++;
+						this->_cacheLookup(className, filePath);
+
 						/**
 						 * Simulate a require
 						 */
@@ -465,6 +758,11 @@ class Loader implements EventsAwareInterface
 			}
 		}
 
+		/**
+		 * Remember that the class doesn't exist
+		 */
+		this->_cacheLookup(className, "");
+
 		/**
 		 * Call 'afterCheckClass' event
 		 */
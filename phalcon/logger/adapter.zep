@@ -61,6 +61,48 @@ abstract class Adapter
 	 */
 	protected _logLevel = 9;
 
+	/**
+	 * Whether formatted lines are buffered instead of written one by one
+	 *
+	 * @var boolean
+	 */
+	protected _buffered = false;
+
+	/**
+	 * Pending formatted lines
+	 *
+	 * @var string
+	 */
+	protected _buffer = "";
+
+	/**
+	 * Number of lines in the buffer
+	 *
+	 * @var int
+	 */
+	protected _bufferCount = 0;
+
+	/**
+	 * Number of bytes that triggers a flush
+	 *
+	 * @var int
+	 */
+	protected _bufferSize = 65536;
+
+	/**
+	 * Number of lines that triggers a flush (0 means no limit)
+	 *
+	 * @var int
+	 */
+	protected _bufferLines = 0;
+
+	/**
+	 * Messages with this severity or a more severe one are flushed immediately
+	 *
+	 * @var int
+	 */
+	protected _flushLevel = 3;
+
 	/**
 	 * Filters the logs sent to the handlers that are less or equal than a specific level
 	 */
@@ -225,6 +267,92 @@ abstract class Adapter
 		return this;
 	}
 
+	/**
+	 * Checks if the adapter buffers the log lines
+	 */
+	public function isBuffered() -> boolean
+	{
+		return this->_buffered;
+	}
+
+	/**
+	 * Returns the formatted lines waiting to be written
+	 */
+	public function getBuffer() -> string
+	{
+		return this->_buffer;
+	}
+
+	/**
+	 * Reads the buffering options and registers the shutdown flush.
+	 * Adapters enabling this must implement a public flush() method
+	 */
+	protected function _setupBuffer(var options) -> void
+	{
+		var buffer, bufferSize, bufferLines, flushLevel;
+
+		if typeof options != "array" {
+			return;
+		}
+
+		if !fetch buffer, options["buffer"] {
+			return;
+		}
+
+		if !buffer {
+			return;
+		}
+
+		if fetch bufferSize, options["bufferSize"] {
+			let this->_bufferSize = (int) bufferSize;
+		}
+
+		if fetch bufferLines, options["bufferLines"] {
+			let this->_bufferLines = (int) bufferLines;
+		}
+
+		if fetch flushLevel, options["flushLevel"] {
+			let this->_flushLevel = (int) flushLevel;
+		}
+
+		let this->_buffered = true;
+
+		register_shutdown_function([this, "flush"]);
+	}
+
+	/**
+	 * Appends a formatted line to the buffer, returns true if the buffer must be flushed
+	 */
+	protected function _appendBuffer(string line, int type) -> boolean
+	{
+		let this->_buffer .= line;
+		let this->_bufferCount++;
+
+		if type <= this->_flushLevel {
+			return true;
+		}
+
+		if this->_bufferLines > 0 && this->_bufferCount >= this->_bufferLines {
+			return true;
+		}
+
+		return strlen(this->_buffer) >= this->_bufferSize;
+	}
+
+	/**
+	 * Empties the buffer returning its contents
+	 */
+	protected function _takeBuffer() -> string
+	{
+		var buffer;
+
+		let buffer = this->_buffer,
+			this->_buffer = "",
+			this->_bufferCount = 0;
+
+		return buffer;
+	}
+
 	/**
 	 * Logs messages to the internal logger. Appends logs to the logger
 	 */
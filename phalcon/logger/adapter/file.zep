@@ -37,6 +37,19 @@ use Phalcon\Logger\Formatter\Line as LineFormatter;
  *	$logger->error("This is another error");
  *	$logger->close();
  *</code>
+ *
+ * Lines can be buffered and written in a single call when bufferSize bytes or
+ * bufferLines lines are pending, when a message at or above flushLevel is logged,
+ * on close() and at shutdown:
+ *
+ *<code>
+ *	$logger = new \Phalcon\Logger\Adapter\File("app/logs/test.log", [
+ *		"buffer"      => true,
+ *		"bufferSize"  => 65536,
+ *		"bufferLines" => 100,
+ *		"flushLevel"  => \Phalcon\Logger::ERROR
+ *	]);
+ *</code>
  */
 class File extends Adapter implements AdapterInterface
 {
@@ -91,6 +104,8 @@ class File extends Adapter implements AdapterInterface
 		let this->_path = name,
 			this->_options = options,
 			this->_fileHandler = handler;
+
+		this->_setupBuffer(options);
 	}
 
 	/**
@@ -117,14 +132,37 @@ class File extends Adapter implements AdapterInterface
 			throw new Exception("Cannot send message to the log because it is invalid");
 		}
 
+		if this->_buffered {
+			if this->_appendBuffer(this->getFormatter()->format(message, type, time, context), type) {
+				fwrite(fileHandler, this->_takeBuffer());
+			}
+			return;
+		}
+
 		fwrite(fileHandler, this->getFormatter()->format(message, type, time, context));
 	}
 
+	/**
+	 * Writes the buffered lines to the file in a single call
+	 */
+	public function flush() -> <AdapterInterface>
+	{
+		var fileHandler;
+
+		let fileHandler = this->_fileHandler;
+		if this->_bufferCount && typeof fileHandler == "resource" {
+			fwrite(fileHandler, this->_takeBuffer());
+		}
+
+		return this;
+	}
+
 	/**
  	 * Closes the logger
  	 */
 	public function close() -> boolean
 	{
+		this->flush();
 		return fclose(this->_fileHandler);
 	}
 
@@ -36,6 +36,13 @@ use Phalcon\Logger\Formatter\Line as LineFormatter;
  *	$logger->log(\Phalcon\Logger::ERROR, "This is an error");
  *	$logger->error("This is another error");
  *</code>
+ *
+ * Pass the "buffer" option (and optionally "bufferSize", "bufferLines" and
+ * "flushLevel") to write the lines in batches
+ *
+ *<code>
+ *	$logger = new \Phalcon\Logger\Adapter\Stream("php://stderr", ["buffer" => true]);
+ *</code>
  */
 class Stream extends Adapter implements AdapterInterface
 {
@@ -74,6 +81,8 @@ class Stream extends Adapter implements AdapterInterface
 		}
 
 		let this->_stream = stream;
+
+		this->_setupBuffer(options);
 	}
 
 	/**
@@ -100,14 +109,37 @@ class Stream extends Adapter implements AdapterInterface
 			throw new Exception("Cannot send message to the log because it is invalid");
 		}
 
+		if this->_buffered {
+			if this->_appendBuffer(this->getFormatter()->format(message, type, time, context), type) {
+				fwrite(stream, this->_takeBuffer());
+			}
+			return;
+		}
+
 		fwrite(stream, this->getFormatter()->format(message, type, time, context));
 	}
 
+	/**
+	 * Writes the buffered lines to the stream in a single call
+	 */
+	public function flush() -> <AdapterInterface>
+	{
+		var stream;
+
+		let stream = this->_stream;
+		if this->_bufferCount && typeof stream == "resource" {
+			fwrite(stream, this->_takeBuffer());
+		}
+
+		return this;
+	}
+
 	/**
  	 * Closes the logger
  	 */
 	public function close() -> boolean
 	{
+		this->flush();
 		return fclose(this->_stream);
 	}
 }
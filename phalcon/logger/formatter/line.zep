@@ -43,6 +43,27 @@ class Line extends Formatter
 	 */
 	protected _format = "[%date%][%type%] %message%" { get, set };
 
+	/**
+	 * Timestamp of the last formatted date
+	 *
+	 * @var int
+	 */
+	protected _lastTimestamp;
+
+	/**
+	 * Date format used for the last formatted date
+	 *
+	 * @var string
+	 */
+	protected _lastDateFormat;
+
+	/**
+	 * Last formatted date, reused while the second does not change
+	 *
+	 * @var string
+	 */
+	protected _lastDate;
+
 	/**
 	 * Phalcon\Logger\Formatter\Line construct
 	 *
@@ -70,15 +91,22 @@ class Line extends Formatter
 	 */
 	public function format(string message, int type, int timestamp, var context = null) -> string
 	{
-		var format;
+		var format, dateFormat;
 
 		let format = this->_format;
 
 		/**
 		 * Check if the format has the %date% placeholder
+		 * The formatted date is reused for messages logged in the same second
 		 */
 		if memstr(format, "%date%") {
-			let format = str_replace("%date%", date(this->_dateFormat, timestamp), format);
+			let dateFormat = this->_dateFormat;
+			if this->_lastTimestamp !== timestamp || this->_lastDateFormat !== dateFormat {
+				let this->_lastDate = date(dateFormat, timestamp),
+					this->_lastTimestamp = timestamp,
+					this->_lastDateFormat = dateFormat;
+			}
+			let format = str_replace("%date%", this->_lastDate, format);
 		}
 
 		/**
@@ -118,6 +118,14 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 
 	const DIRTY_STATE_DETACHED = 2;
 
+	const HYDRATE_CAST_NONE = 0;
+
+	const HYDRATE_CAST_INTEGER = 1;
+
+	const HYDRATE_CAST_DOUBLE = 2;
+
+	const HYDRATE_CAST_BOOLEAN = 3;
+
 	/**
 	 * Phalcon\Mvc\Model constructor
 	 */
@@ -506,9 +514,31 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	 */
 	public static function cloneResultMap(var base, array! data, var columnMap, int dirtyState = 0, boolean keepSnapshots = null) -> <Model>
 	{
-		var instance, attribute, key, value, castValue, attributeName;
+		return self::assignResultMap(clone base, data, columnMap, dirtyState, keepSnapshots);
+	}
 
-		let instance = clone base;
+	/**
+	 * Assigns values to an existing model from an array using a column map.
+	 * Forward-only resultsets use it to reuse the same instance for every row
+	 *
+	 *<code>
+	 *$robot = \Phalcon\Mvc\Model::assignResultMap($robot, array(
+	 *  'type' => 'mechanical',
+	 *  'name' => 'Astro Boy',
+	 *  'year' => 1952
+	 *));
+	 *</code>
+	 *
+	 * @param \Phalcon\Mvc\ModelInterface|\Phalcon\Mvc\Model\Row instance
+	 * @param array data
+	 * @param array columnMap
+	 * @param int dirtyState
+	 * @param boolean keepSnapshots
+	 * @return \Phalcon\Mvc\Model
+	 */
+	public static function assignResultMap(var instance, array! data, var columnMap, int dirtyState = 0, boolean keepSnapshots = null) -> <Model>
+	{
+		var attribute, key, value, castValue, attributeName;
 
 		// Change the dirty state to persistent
 		instance->setDirtyState(dirtyState);
@@ -597,6 +627,153 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		return instance;
 	}
 
+	/**
+	 * Builds the hydration plan for rows with the same columns as the passed one. The plan is a list
+	 * with an entry for every column in the row containing the attribute name and how the value must
+	 * be casted, columns that must be ignored have a null entry
+	 *
+	 * @param array data
+	 * @param array columnMap
+	 * @return array
+	 */
+	public static function getHydrationPlan(array! data, var columnMap) -> array
+	{
+		var plan, key, attribute;
+
+		let plan = [];
+
+		for key, _ in data {
+
+			// Only string keys in the data are valid
+			if typeof key != "string" {
+				let plan[] = null;
+				continue;
+			}
+
+			if typeof columnMap != "array" {
+				let plan[] = [key, self::HYDRATE_CAST_NONE];
+				continue;
+			}
+
+			// Every field must be part of the column map
+			if !fetch attribute, columnMap[key] {
+				if !globals_get("orm.ignore_unknown_columns") {
+					throw new Exception("Column '" . key . "' doesn't make part of the column map");
+				}
+				let plan[] = null;
+				continue;
+			}
+
+			if typeof attribute != "array" {
+				let plan[] = [attribute, self::HYDRATE_CAST_NONE];
+				continue;
+			}
+
+			switch attribute[1] {
+
+				case Column::TYPE_INTEGER:
+					let plan[] = [attribute[0], self::HYDRATE_CAST_INTEGER];
+					break;
+
+				case Column::TYPE_DOUBLE:
+				case Column::TYPE_DECIMAL:
+				case Column::TYPE_FLOAT:
+					let plan[] = [attribute[0], self::HYDRATE_CAST_DOUBLE];
+					break;
+
+				case Column::TYPE_BOOLEAN:
+					let plan[] = [attribute[0], self::HYDRATE_CAST_BOOLEAN];
+					break;
+
+				default:
+					let plan[] = [attribute[0], self::HYDRATE_CAST_NONE];
+					break;
+			}
+		}
+
+		return plan;
+	}
+
+	/**
+	 * Assigns values to a model from an array following a plan built by getHydrationPlan(),
+	 * the values are read in the order of the row without looking up the column map
+	 *
+	 * @param \Phalcon\Mvc\ModelInterface instance
+	 * @param array data
+	 * @param array plan
+	 * @param array columnMap
+	 * @param int dirtyState
+	 * @param boolean keepSnapshots
+	 * @return \Phalcon\Mvc\Model
+	 */
+	public static function assignHydrationPlan(var instance, array! data, array! plan, var columnMap, int dirtyState = 0, boolean keepSnapshots = null) -> <Model>
+	{
+		var value, entry, attributeName;
+		int position = 0;
+
+		// Change the dirty state to persistent
+		instance->setDirtyState(dirtyState);
+
+		for value in data {
+
+			let entry = plan[position],
+				position++;
+
+			if entry === null {
+				continue;
+			}
+
+			let attributeName = entry[0];
+
+			switch entry[1] {
+
+				case self::HYDRATE_CAST_NONE:
+					let instance->{attributeName} = value;
+					break;
+
+				case self::HYDRATE_CAST_INTEGER:
+					if value != "" && value !== null {
+						let instance->{attributeName} = intval(value, 10);
+					} else {
+						let instance->{attributeName} = null;
+					}
+					break;
+
+				case self::HYDRATE_CAST_DOUBLE:
+					if value != "" && value !== null {
+						let instance->{attributeName} = doubleval(value);
+					} else {
+						let instance->{attributeName} = null;
+					}
+					break;
+
+				default:
+					if value != "" && value !== null {
+						let instance->{attributeName} = (boolean) value;
+					} else {
+						let instance->{attributeName} = null;
+					}
+					break;
+			}
+		}
+
+		/**
+		 * Models that keep snapshots store the original data in t
+		 */
+		if keepSnapshots {
+			instance->setSnapshotData(data, columnMap);
+		}
+
+		/**
+		 * Call afterFetch, this allows the developer to execute actions after a record is fetched from the database
+		 */
+		if method_exists(instance, "afterFetch") {
+			instance->{"afterFetch"}();
+		}
+
+		return instance;
+	}
+
 	/**
 	 * Returns an hydrated result based on the data and the column map
 	 *
@@ -4407,7 +4584,7 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 	{
 		var disableEvents, columnRenaming, notNullValidations,
 			exceptionOnFailedSave, phqlLiterals, virtualForeignKeys,
-			lateStateBinding, castOnHydrate, ignoreUnknownColumns;
+			lateStateBinding, castOnHydrate, ignoreUnknownColumns, lazyCount;
 
 		/**
 		 * Enables/Disables globally the internal events
@@ -4471,6 +4648,13 @@ abstract class Model implements EntityInterface, ModelInterface, ResultInterface
 		if fetch ignoreUnknownColumns, options["ignoreUnknownColumns"] {
 			globals_set("orm.ignore_unknown_columns", ignoreUnknownColumns);
 		}
+
+		/**
+		 * Enables/Disables counting the rows of resultsets only when they're required
+		 */
+		if fetch lazyCount, options["lazyCount"] {
+			globals_set("orm.lazy_count", lazyCount);
+		}
 	}
 
 	/**
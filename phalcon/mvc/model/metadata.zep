@@ -652,6 +652,64 @@ abstract class MetaData implements InjectionAwareInterface, MetaDataInterface
 		}
 	}
 
+	/**
+	 * Reads the meta-data and column maps of every model in a directory, this allows
+	 * to store the meta-data of the whole application at deploy time.
+	 * Returns the list of processed models
+	 *
+	 *<code>
+	 *	$metaData->warmUp('app/models/', 'Store\\Models\\');
+	 *</code>
+	 */
+	public function warmUp(string! directory, string namespaceName = null) -> array
+	{
+		var iterator, file, path, className, reflection, model, models;
+		int length;
+
+		let directory = rtrim(directory, "\\/"),
+			length = strlen(directory) + 1,
+			models = [];
+
+		let iterator = new \RecursiveIteratorIterator(new \RecursiveDirectoryIterator(directory, \FilesystemIterator::SKIP_DOTS));
+		for file in iterator {
+
+			let path = file->getPathname();
+			if !ends_with(path, ".php") {
+				continue;
+			}
+
+			/**
+			 * The class name is obtained from the relative path of the file
+			 */
+			let className = namespaceName . str_replace(["/", "\\"], "\\", substr(path, length, -4));
+
+			if !class_exists(className) {
+				require path;
+				if !class_exists(className) {
+					continue;
+				}
+			}
+
+			if !is_subclass_of(className, "Phalcon\\Mvc\\ModelInterface") {
+				continue;
+			}
+
+			let reflection = new \ReflectionClass(className);
+			if !reflection->isInstantiable() {
+				continue;
+			}
+
+			let model = new {className}();
+
+			this->readMetaData(model);
+			this->readColumnMap(model);
+
+			let models[] = className;
+		}
+
+		return models;
+	}
+
 	/**
 	 * Checks if the internal meta-data container is empty
 	 *
@@ -0,0 +1,268 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Mvc\Model\MetaData;
+
+use Phalcon\Mvc\Model\MetaData;
+use Phalcon\Mvc\Model\Exception;
+
+/**
+ * Phalcon\Mvc\Model\MetaData\Shared
+ *
+ * Stores the meta-data of all the models in a single PHP file. The opcode cache keeps the
+ * compiled file in shared memory so the meta-data is available in every request without
+ * reading or unserializing it per model. The stored meta-data is discarded when the
+ * schema version changes.
+ *
+ *<code>
+ * $metaData = new \Phalcon\Mvc\Model\Metadata\Shared(array(
+ *    'metaDataFile'  => 'app/cache/metadata.php',
+ *    'schemaVersion' => '2016-06-01'
+ * ));
+ *
+ * // At deploy time
+ * $metaData->warmUp('app/models/', 'Store\\Models\\');
+ *</code>
+ */
+class Shared extends MetaData
+{
+
+	protected _metaDataFile = "./metadata.php";
+
+	protected _schemaVersion = "" { get };
+
+	protected _store;
+
+	protected _autoSave = true;
+
+	/**
+	 * Phalcon\Mvc\Model\MetaData\Shared constructor
+	 *
+	 * @param array options
+	 */
+	public function __construct(options = null)
+	{
+		var metaDataFile, schemaVersion, store;
+
+		if typeof options == "array" {
+			if fetch metaDataFile, options["metaDataFile"] {
+				let this->_metaDataFile = metaDataFile;
+			}
+			if fetch schemaVersion, options["schemaVersion"] {
+				let this->_schemaVersion = (string) schemaVersion;
+			}
+		}
+
+		/**
+		 * The whole store is loaded at once
+		 */
+		let store = this->_getStore(),
+			this->_metaData = store["meta"],
+			this->_columnMap = store["map"];
+	}
+
+	/**
+	 * Returns the meta-data store, a store written with another schema version is discarded
+	 */
+	protected function _getStore() -> array
+	{
+		var store, metaDataFile;
+
+		let store = this->_store;
+		if typeof store == "array" {
+			return store;
+		}
+
+		let metaDataFile = this->_metaDataFile,
+			store = null;
+
+		if file_exists(metaDataFile) {
+			let store = require metaDataFile;
+		}
+
+		if typeof store != "array" || !isset store["version"] || store["version"] !== this->_schemaVersion || !isset store["meta"] || !isset store["map"] {
+			let store = ["version": this->_schemaVersion, "meta": [], "map": []];
+		}
+
+		let this->_store = store;
+		return store;
+	}
+
+	/**
+	 * Reads meta-data from the store
+	 *
+	 * @param string key
+	 * @return mixed
+	 */
+	public function read(string! key)
+	{
+		var store, data;
+
+		let store = this->_getStore();
+
+		if starts_with(key, "meta-") {
+			if fetch data, store["meta"][substr(key, 5)] {
+				return data;
+			}
+		} else {
+			if starts_with(key, "map-") {
+				if fetch data, store["map"][substr(key, 4)] {
+					return data;
+				}
+			}
+		}
+
+		return null;
+	}
+
+	/**
+	 * Writes the meta-data to the store and saves it
+	 *
+	 * @param string key
+	 * @param array data
+	 */
+	public function write(string! key, var data) -> void
+	{
+		var store, section, sectionName, name;
+
+		if starts_with(key, "meta-") {
+			let sectionName = "meta",
+				name = substr(key, 5);
+		} else {
+			if starts_with(key, "map-") {
+				let sectionName = "map",
+					name = substr(key, 4);
+			} else {
+				throw new Exception("Invalid meta-data key " . key);
+			}
+		}
+
+		let store = this->_getStore(),
+			section = store[sectionName],
+			section[name] = data,
+			store[sectionName] = section,
+			this->_store = store;
+
+		if this->_autoSave {
+			this->save();
+		}
+	}
+
+	/**
+	 * Saves the store replacing the file atomically. Entries stored meanwhile by other
+	 * processes with the same schema version are merged under an exclusive lock, so workers
+	 * reading different models at the same time don't overwrite each other
+	 */
+	public function save() -> boolean
+	{
+		var metaDataFile, temporaryFile, handle, store, stored, sectionName, section, storedSection,
+			name, data;
+
+		let metaDataFile = this->_metaDataFile,
+			temporaryFile = metaDataFile . "." . uniqid() . ".tmp";
+
+		let handle = fopen(metaDataFile . ".lock", "c");
+		if !handle {
+			throw new Exception("Meta-Data file cannot be locked");
+		}
+
+		if !flock(handle, LOCK_EX) {
+			fclose(handle);
+			throw new Exception("Meta-Data file cannot be locked");
+		}
+
+		/**
+		 * The opcode cache could still hold the file replaced by another process
+		 */
+		let stored = null;
+		if file_exists(metaDataFile) {
+			if function_exists("opcache_invalidate") {
+				opcache_invalidate(metaDataFile, true);
+			}
+			let stored = require metaDataFile;
+		}
+
+		let store = this->_getStore();
+		if typeof stored == "array" && isset stored["version"] && stored["version"] === store["version"] {
+			for sectionName in ["meta", "map"] {
+				if fetch storedSection, stored[sectionName] {
+					if typeof storedSection == "array" {
+						let section = store[sectionName];
+						for name, data in storedSection {
+							if !isset section[name] {
+								let section[name] = data;
+							}
+						}
+						let store[sectionName] = section;
+					}
+				}
+			}
+			let this->_store = store;
+		}
+
+		if file_put_contents(temporaryFile, "<?php return " . var_export(store, true) . "; ") === false {
+			flock(handle, LOCK_UN);
+			fclose(handle);
+			throw new Exception("Meta-Data file cannot be written");
+		}
+
+		if !rename(temporaryFile, metaDataFile) {
+			unlink(temporaryFile);
+			flock(handle, LOCK_UN);
+			fclose(handle);
+			throw new Exception("Meta-Data file cannot be written");
+		}
+
+		flock(handle, LOCK_UN);
+		fclose(handle);
+
+		return true;
+	}
+
+	/**
+	 * Reads the meta-data of every model in a directory saving the store once
+	 */
+	public function warmUp(string! directory, string namespaceName = null) -> array
+	{
+		var models, e;
+
+		let this->_autoSave = false;
+
+		try {
+			let models = parent::warmUp(directory, namespaceName);
+		} catch \Exception, e {
+			let this->_autoSave = true;
+			throw e;
+		}
+
+		let this->_autoSave = true;
+		this->save();
+
+		return models;
+	}
+
+	/**
+	 * Resets internal meta-data and the loaded store in order to regenerate them
+	 */
+	public function reset() -> void
+	{
+		let this->_store = ["version": this->_schemaVersion, "meta": [], "map": []];
+		parent::reset();
+	}
+}
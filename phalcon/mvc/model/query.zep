@@ -104,6 +104,12 @@ class Query implements QueryInterface, InjectionAwareInterface
 
 	static protected _irPhqlCache;
 
+	static protected _persistentCache;
+
+	static protected _persistentCacheVersion;
+
+	static protected _persistentCacheStats;
+
 	const TYPE_SELECT = 309;
 
 	const TYPE_INSERT = 306;
@@ -2399,18 +2405,48 @@ class Query implements QueryInterface, InjectionAwareInterface
 	 */
 	public function parse() -> array
 	{
-		var intermediate, phql, ast, irPhql, uniqueId, type;
+		var intermediate, phql, ast, irPhql, uniqueId, type,
+			persistentCache, persistentKey, cached, stats;
 
 		let intermediate = this->_intermediate;
 		if typeof intermediate == "array" {
 			return intermediate;
 		}
 
+		let phql = this->_phql,
+			persistentCache = self::_persistentCache,
+			persistentKey = null;
+
+		/**
+		 * Check if the intermediate representation was stored by a previous request
+		 */
+		if typeof persistentCache == "object" {
+
+			let persistentKey = self::getPersistentCacheKey(phql, this->_enableImplicitJoins);
+
+			if !fetch cached, self::_irPhqlCache[persistentKey] {
+				let cached = persistentCache->get(persistentKey);
+			}
+
+			let stats = self::getPersistentCacheStats();
+
+			if typeof cached == "array" {
+				let stats["hits"] = stats["hits"] + 1,
+					self::_persistentCacheStats = stats,
+					self::_irPhqlCache[persistentKey] = cached,
+					this->_type = cached["type"],
+					this->_intermediate = cached["intermediate"];
+				return cached["intermediate"];
+			}
+
+			let stats["misses"] = stats["misses"] + 1,
+				self::_persistentCacheStats = stats;
+		}
+
 		/**
 		 * This function parses the PHQL statement
 		 */
-		let phql = this->_phql,
-			ast = phql_parse_phql(phql);
+		let ast = phql_parse_phql(phql);
 
 		let irPhql = null, uniqueId = null;
 
@@ -2473,10 +2509,84 @@ class Query implements QueryInterface, InjectionAwareInterface
 			let self::_irPhqlCache[uniqueId] = irPhql;
 		}
 
+		/**
+		 * Share the intermediate representation with the next requests
+		 */
+		if persistentKey !== null {
+			let cached = ["type": this->_type, "intermediate": irPhql],
+				self::_irPhqlCache[persistentKey] = cached;
+			persistentCache->save(persistentKey, cached);
+		}
+
 		let this->_intermediate = irPhql;
 		return irPhql;
 	}
 
+	/**
+	 * Sets a cache backend where the intermediate representation of the PHQL statements
+	 * is stored across requests, the schema version must change every time the models
+	 * metadata changes. Pass null to disable the persistent cache
+	 *
+	 *<code>
+	 * Phalcon\Mvc\Model\Query::setPersistentCache(
+	 *     new Phalcon\Cache\Backend\Apc(new Phalcon\Cache\Frontend\Data(["lifetime" => 86400])),
+	 *     "20160520"
+	 * );
+	 *</code>
+	 */
+	public static function setPersistentCache(<BackendInterface> cache = null, string version = "") -> void
+	{
+		let self::_persistentCache = cache,
+			self::_persistentCacheVersion = version,
+			self::_persistentCacheStats = ["hits": 0, "misses": 0];
+	}
+
+	/**
+	 * Returns the cache backend used to store the intermediate representations across requests
+	 */
+	public static function getPersistentCache() -> <BackendInterface> | null
+	{
+		return self::_persistentCache;
+	}
+
+	/**
+	 * Returns the number of hits and misses in the persistent cache for the current request
+	 */
+	public static function getPersistentCacheStats() -> array
+	{
+		var stats;
+
+		let stats = self::_persistentCacheStats;
+		if typeof stats != "array" {
+			return ["hits": 0, "misses": 0];
+		}
+		return stats;
+	}
+
+	/**
+	 * Stops using the intermediate representations stored in the persistent cache by switching
+	 * to a new schema version, the version is part of the cache keys so the old entries are just
+	 * left to expire. Without a version a unique one is generated, it only applies to the current
+	 * process, other processes must be given the same version with setPersistentCache()
+	 */
+	public static function invalidatePersistentCache(string version = null) -> void
+	{
+		if version === null {
+			let version = self::_persistentCacheVersion . "." . uniqid();
+		}
+
+		let self::_persistentCacheVersion = version,
+			self::_irPhqlCache = [];
+	}
+
+	/**
+	 * Returns the key used to store a PHQL statement in the persistent cache
+	 */
+	protected static function getPersistentCacheKey(string! phql, boolean enableImplicitJoins) -> string
+	{
+		return "phql-" . md5(self::_persistentCacheVersion . ":" . (enableImplicitJoins ? "1" : "0") . ":" . phql);
+	}
+
 	/**
 	 * Returns the current cache backend instance
 	 */
@@ -2731,9 +2841,9 @@ class Query implements QueryInterface, InjectionAwareInterface
 		let result = connection->query(sqlSelect, processed, processedTypes);
 
 		/**
-		 * Check if the query has data
+		 * Check if the query has data, lazy resultsets find it out through the cursor
 		 */
-		if result->numRows(result) {
+		if globals_get("orm.lazy_count") || result->numRows(result) {
 			let resultData = result;
 		} else {
 			let resultData = false;
@@ -3243,7 +3353,7 @@ class Query implements QueryInterface, InjectionAwareInterface
 	{
 		var uniqueRow, cacheOptions, key, cacheService,
 			cache, result, preparedResult, defaultBindParams, mergedParams,
-			defaultBindTypes, mergedTypes, type, lifetime, intermediate;
+			defaultBindTypes, mergedTypes, type, lifetime, intermediate, stale;
 
 		let uniqueRow = this->_uniqueRow;
 
@@ -3280,7 +3390,21 @@ class Query implements QueryInterface, InjectionAwareInterface
 				throw new Exception("Cache service must be an object");
 			}
 
-			let result = cache->get(key, lifetime);
+			/**
+			 * In stale mode expired resultsets are served while a single worker regenerates them
+			 */
+			if !fetch stale, cacheOptions["stale"] {
+				let stale = false;
+			}
+
+			if stale {
+				if !method_exists(cache, "getStale") {
+					throw new Exception("Cache service doesn't support stale resultsets");
+				}
+				let result = cache->getStale(key, lifetime);
+			} else {
+				let result = cache->get(key, lifetime);
+			}
 			if result !== null {
 
 				if typeof result != "object" {
@@ -3380,7 +3504,11 @@ class Query implements QueryInterface, InjectionAwareInterface
 				throw new Exception("Only PHQL statements that return resultsets can be cached");
 			}
 
-			cache->save(key, result, lifetime);
+			if stale {
+				cache->saveStale(key, result, lifetime);
+			} else {
+				cache->save(key, result, lifetime);
+			}
 		}
 
 		/**
@@ -79,6 +79,8 @@ abstract class Resultset
 
 	protected _hydrateMode = 0;
 
+	protected _streaming = false;
+
 	const TYPE_RESULT_FULL = 0;
 
 	const TYPE_RESULT_PARTIAL = 1;
@@ -126,6 +128,14 @@ abstract class Resultset
 		 */
 		result->setFetchMode(Db::FETCH_ASSOC);
 
+		/**
+		 * Lazy resultsets don't count the rows until count() is called,
+		 * rows are read through the live cursor instead
+		 */
+		if globals_get("orm.lazy_count") {
+			return;
+		}
+
 		/**
 		 * Update the row-count
 		 */
@@ -170,7 +180,21 @@ abstract class Resultset
 	 */
 	public function valid() -> boolean
 	{
-		return this->_pointer < this->_count;
+		var row;
+
+		if this->_count !== null {
+			return this->_pointer < this->_count;
+		}
+
+		/**
+		 * The row-count is unknown, check if the cursor has a row in the current position
+		 */
+		if this->_row === null {
+			this->seek(this->_pointer);
+		}
+
+		let row = this->_row;
+		return row !== null && row !== false;
 	}
 
 	/**
@@ -178,7 +202,7 @@ abstract class Resultset
 	 */
 	public function key() -> int | null
 	{
-		if this->_pointer >= this->_count {
+		if !this->valid() {
 			return null;
 		}
 
@@ -228,6 +252,14 @@ abstract class Resultset
 			}
 
 			if this->_pointer > position {
+
+				/**
+				* Streaming resultsets never re-execute the query
+				*/
+				if this->_streaming {
+					throw new Exception("Streaming resultsets can only be traversed forward");
+				}
+
 				/**
 				* Current pointer is ahead requested position: e.g. request a previous row
 				* It is not possible to rewind. Re-execute query with dataSeek
@@ -257,7 +289,18 @@ abstract class Resultset
 	 */
 	public final function count() -> int
 	{
-		return this->_count;
+		var count;
+
+		/**
+		 * Lazy resultsets count the rows the first time they're required
+		 */
+		let count = this->_count;
+		if count === null {
+			let count = (int) this->_result->numRows(),
+				this->_count = count;
+		}
+
+		return count;
 	}
 
 	/**
@@ -265,7 +308,7 @@ abstract class Resultset
 	 */
 	public function offsetExists(int index) -> boolean
 	{
-		return index < this->_count;
+		return index < this->count();
 	}
 
 	/**
@@ -273,7 +316,7 @@ abstract class Resultset
 	 */
 	public function offsetGet(int! index) -> <ModelInterface> | boolean
 	{
-		if index < this->_count {
+		if index < this->count() {
 	   		/**
 	   		 * Move the cursor to the specific position
 	   		 */
@@ -317,7 +360,7 @@ abstract class Resultset
 	 */
 	public function getFirst() -> <ModelInterface> | boolean
 	{
-		if this->_count == 0 {
+		if this->_count !== null && this->_count == 0 {
 			return false;
 		}
 
@@ -331,7 +374,7 @@ abstract class Resultset
 	public function getLast() -> <ModelInterface> | boolean
 	{
 		var count;
-		let count = this->_count;
+		let count = this->count();
 		if count == 0 {
 			return false;
 		}
@@ -374,6 +417,86 @@ abstract class Resultset
 		return this->_hydrateMode;
 	}
 
+	/**
+	 * Sets whether the resultset must be traversed in streaming mode. Streaming resultsets
+	 * only move forward over the database cursor, never re-execute the query and reuse the
+	 * same hydrated record for every row, so they can traverse large results in bounded memory
+	 *
+	 *<code>
+	 * $robots = Robots::find();
+	 * $robots->setStreaming(true);
+	 * foreach ($robots as $robot) {
+	 *     echo $robot->name, "\n";
+	 * }
+	 *</code>
+	 */
+	public function setStreaming(boolean streaming) -> <Resultset>
+	{
+		let this->_streaming = streaming;
+		return this;
+	}
+
+	/**
+	 * Checks whether the resultset is traversed in streaming mode
+	 */
+	public function isStreaming() -> boolean
+	{
+		return this->_streaming;
+	}
+
+	/**
+	 * Returns the next chunk of rows starting from the current position and moves the cursor
+	 * after them. Every row in the chunk is an independent record. An empty array is returned
+	 * when the end of the resultset is reached
+	 *
+	 *<code>
+	 * $robots = Robots::find();
+	 * $robots->setStreaming(true);
+	 * while ($batch = $robots->fetchBatch(1000)) {
+	 *     foreach ($batch as $robot) {
+	 *         echo $robot->name, "\n";
+	 *     }
+	 * }
+	 *</code>
+	 */
+	public function fetchBatch(int size) -> array
+	{
+		var batch, streaming, e;
+
+		if size < 1 {
+			throw new Exception("The batch size must be greater than zero");
+		}
+
+		let batch = [],
+			streaming = this->_streaming;
+
+		/**
+		 * Fetch the first row if the cursor wasn't used yet
+		 */
+		if this->_row === null {
+			this->seek(this->_pointer);
+		}
+
+		/**
+		 * Rows in a batch are kept together so they can't share the streamed record
+		 */
+		let this->_streaming = false;
+
+		try {
+			while count(batch) < size && this->valid() {
+				let batch[] = this->{"current"}();
+				this->next();
+			}
+		} catch \Exception, e {
+			let this->_streaming = streaming;
+			throw e;
+		}
+
+		let this->_streaming = streaming;
+
+		return batch;
+	}
+
 	/**
 	 * Returns the associated cache for the resultset
 	 */
@@ -42,6 +42,8 @@ class Complex extends Resultset implements ResultsetInterface
 	*/
 	protected _disableHydration = false;
 
+	protected _streamedRows;
+
 	/**
 	 * Phalcon\Mvc\Model\Resultset\Complex constructor
 	 *
@@ -67,7 +69,7 @@ class Complex extends Resultset implements ResultsetInterface
 		var row, hydrateMode, eager,
 			dirtyState, alias, activeRow, type, column, columnValue,
 			value, attribute, source, attributes,
-			columnMap, rowModel, keepSnapshots, sqlAlias, modelName;
+			columnMap, rowModel, keepSnapshots, sqlAlias, modelName, streamedRow;
 
 		let activeRow = this->_activeRow;
 		if activeRow !== null {
@@ -176,17 +178,26 @@ class Complex extends Resultset implements ResultsetInterface
 								let modelName = "Phalcon\\Mvc\\Model";
 							}
 
-							let value = {modelName}::cloneResultMap(
-								column["instance"], rowModel, columnMap, dirtyState, keepSnapshots
-							);
+						} else {
+							let modelName = "Phalcon\\Mvc\\Model";
+						}
 
+						// Streaming resultsets reuse the record hydrated for the previous row
+						if this->_streaming && fetch streamedRow, this->_streamedRows[alias] {
+							let value = {modelName}::assignResultMap(
+								streamedRow, rowModel, columnMap, dirtyState, keepSnapshots
+							);
 						} else {
 
 							// Get the base instance
 						 	// Assign the values to the attributes using a column map
-							let value = Model::cloneResultMap(
+							let value = {modelName}::cloneResultMap(
 								column["instance"], rowModel, columnMap, dirtyState, keepSnapshots
 							);
+
+							if this->_streaming {
+								let this->_streamedRows[alias] = value;
+							}
 						}
 						break;
 
@@ -254,6 +265,11 @@ class Complex extends Resultset implements ResultsetInterface
 	public function toArray() -> array
 	{
 		var records, current;
+
+		if this->_streaming {
+			throw new Exception("Streaming resultsets can't be exported to an array");
+		}
+
 		let records = [];
 		for current in iterator(this) {
 			let records[] = current;
@@ -40,6 +40,10 @@ class Simple extends Resultset
 
 	protected _keepSnapshots = false;
 
+	protected _streamedRow = null;
+
+	protected _hydrationPlan = null;
+
 	/**
 	 * Phalcon\Mvc\Model\Resultset\Simple constructor
 	 *
@@ -67,7 +71,7 @@ class Simple extends Resultset
 	 */
 	public final function current() -> <ModelInterface> | boolean
 	{
-		var row, hydrateMode, columnMap, activeRow, modelName;
+		var row, hydrateMode, columnMap, activeRow, modelName, streamedRow, plan, instance;
 
 		let activeRow = this->_activeRow;
 		if activeRow !== null {
@@ -108,6 +112,7 @@ class Simple extends Resultset
 				 * Set records as dirty state PERSISTENT by default
 				 * Performs the standard hydration based on objects
 				 */
+				let streamedRow = this->_streamedRow;
 				if globals_get("orm.late_state_binding") {
 
 					if this->_model instanceof \Phalcon\Mvc\Model {
@@ -116,22 +121,60 @@ class Simple extends Resultset
 						let modelName = "Phalcon\\Mvc\\Model";
 					}
 
-					let activeRow = {modelName}::cloneResultMap(
-						this->_model,
-						row,
-						columnMap,
-						Model::DIRTY_STATE_PERSISTENT,
-						this->_keepSnapshots
-					);
+					/**
+					 * Streaming resultsets reuse the record hydrated for the previous row
+					 */
+					if this->_streaming && typeof streamedRow == "object" {
+						let activeRow = {modelName}::assignResultMap(
+							streamedRow,
+							row,
+							columnMap,
+							Model::DIRTY_STATE_PERSISTENT,
+							this->_keepSnapshots
+						);
+					} else {
+						let activeRow = {modelName}::cloneResultMap(
+							this->_model,
+							row,
+							columnMap,
+							Model::DIRTY_STATE_PERSISTENT,
+							this->_keepSnapshots
+						);
+					}
+
 				} else {
-					let activeRow = Model::cloneResultMap(
-						this->_model,
+
+					/**
+					 * The hydration plan is built once for all the rows in the resultset
+					 */
+					let plan = this->_hydrationPlan;
+					if typeof plan != "array" || count(plan) != count(row) {
+						let plan = Model::getHydrationPlan(row, columnMap),
+							this->_hydrationPlan = plan;
+					}
+
+					/**
+					 * Streaming resultsets reuse the record hydrated for the previous row
+					 */
+					if this->_streaming && typeof streamedRow == "object" {
+						let instance = streamedRow;
+					} else {
+						let instance = clone this->_model;
+					}
+
+					let activeRow = Model::assignHydrationPlan(
+						instance,
 						row,
+						plan,
 						columnMap,
 						Model::DIRTY_STATE_PERSISTENT,
 						this->_keepSnapshots
 					);
 				}
+
+				if this->_streaming {
+					let this->_streamedRow = activeRow;
+				}
 				break;
 
 			default:
@@ -154,7 +197,7 @@ class Simple extends Resultset
 	public function toArray(boolean renameColumns = true) -> array
 	{
 		var result, records, record, renamed, renamedKey,
-			key, value, renamedRecords, columnMap;
+			key, value, renamedRecords, columnMap, renamedKeys;
 
 		/**
 		 * If _rows is not present, fetchAll from database
@@ -164,6 +207,10 @@ class Simple extends Resultset
 		if typeof records != "array" {
 			let result = this->_result;
 			if this->_row !== null {
+				if this->_streaming {
+					throw new Exception("Streaming resultsets can't be re-executed to export them");
+				}
+
 				// re-execute query if required and fetchAll rows
 				result->execute();
 			}
@@ -185,12 +232,23 @@ class Simple extends Resultset
 				return records;
 			}
 
-			let renamedRecords = [];
+			let renamedRecords = [],
+				renamedKeys = null;
+
 			if typeof records == "array" {
 
 				for record in records {
 
-					let renamed = [];
+					/**
+					 * Records with the same columns as the first one are renamed at once
+					 */
+					if typeof renamedKeys == "array" && count(renamedKeys) == count(record) {
+						let renamedRecords[] = array_combine(renamedKeys, record);
+						continue;
+					}
+
+					let renamed = [],
+						renamedKeys = [];
 					for key, value in record {
 
 						/**
@@ -207,7 +265,8 @@ class Simple extends Resultset
                         	}
 						}
 
-						let renamed[renamedKey] = value;
+						let renamed[renamedKey] = value,
+							renamedKeys[] = renamedKey;
 					}
 
 					/**
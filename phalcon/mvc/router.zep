@@ -94,6 +94,16 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 
 	protected _notFoundPaths;
 
+	protected _useCompiledRoutes = false;
+
+	protected _compiledRoutes = null;
+
+	protected _routesByName = null;
+
+	protected _routesById = null;
+
+	protected _namesVersion = -1;
+
 	const URI_SOURCE_GET_URL = 0;
 
 	const URI_SOURCE_SERVER_REQUEST_URI = 1;
@@ -206,6 +216,187 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 		return this;
 	}
 
+	/**
+	 * Set whether the router must only check the routes that can match the handled URI.
+	 * Static routes are looked up by their pattern and dynamic routes are grouped by
+	 * the literal path prefix of their compiled pattern, the matching order is the same
+	 * as traversing every route in reverse order
+	 *
+	 *<code>
+	 *	$router->useCompiledRoutes(true);
+	 *</code>
+	 */
+	public function useCompiledRoutes(boolean! compiled = true) -> <RouterInterface>
+	{
+		let this->_useCompiledRoutes = compiled;
+		return this;
+	}
+
+	/**
+	 * Builds the lookup tables used by the compiled matching mode. The tables are built
+	 * automatically on the first handled URI, call this method again if a route is
+	 * reconfigured after that
+	 */
+	public function compileRoutes() -> <RouterInterface>
+	{
+		var staticRoutes, prefixedRoutes, fallbackRoutes, position, route, pattern, prefix;
+
+		let staticRoutes = [],
+			prefixedRoutes = [],
+			fallbackRoutes = [];
+
+		for position, route in this->_routes {
+
+			let pattern = route->getCompiledPattern();
+
+			/**
+			 * Patterns without regular expressions are compared literally
+			 */
+			if !memstr(pattern, "^") {
+				let staticRoutes[pattern][position] = route;
+				continue;
+			}
+
+			let prefix = this->_getPatternPrefix(pattern);
+			if prefix {
+				let prefixedRoutes[prefix][position] = route;
+			} else {
+				let fallbackRoutes[position] = route;
+			}
+		}
+
+		let this->_compiledRoutes = [
+			"static": staticRoutes,
+			"prefixed": prefixedRoutes,
+			"fallback": fallbackRoutes
+		];
+
+		return this;
+	}
+
+	/**
+	 * Returns the literal path prefix (up to the last complete segment) a compiled pattern
+	 * requires or false if the pattern can't be indexed by prefix
+	 */
+	protected function _getPatternPrefix(string! pattern) -> string | boolean
+	{
+		char ch;
+		boolean escaped;
+		var end, modifiers, position;
+		string body, prefix;
+
+		/**
+		 * Only anchored patterns without alternatives or modifiers other than 'u' are indexed
+		 */
+		if !starts_with(pattern, "#^") || memstr(pattern, "|") {
+			return false;
+		}
+
+		let end = strrpos(pattern, "#");
+		if end < 2 {
+			return false;
+		}
+
+		let modifiers = substr(pattern, end + 1);
+		if modifiers !== false && modifiers !== "" && modifiers !== "u" {
+			return false;
+		}
+
+		let body = (string) substr(pattern, 2, end - 2),
+			prefix = "",
+			escaped = false;
+
+		for ch in body {
+
+			if escaped {
+
+				/**
+				 * Escaped letters and digits are character classes or assertions
+				 */
+				if (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') {
+					break;
+				}
+
+				let escaped = false;
+			} else {
+
+				if ch == '\\' {
+					let escaped = true;
+					continue;
+				}
+
+				if ch == '.' || ch == '(' || ch == ')' || ch == '[' || ch == '^' || ch == '$' {
+					break;
+				}
+
+				/**
+				 * A quantifier makes the previous literal character optional
+				 */
+				if ch == '?' || ch == '*' || ch == '+' || ch == '{' {
+					let prefix = (string) substr(prefix, 0, -1);
+					break;
+				}
+			}
+
+			let prefix .= ch;
+		}
+
+		if !starts_with(prefix, "/") {
+			return false;
+		}
+
+		let position = strrpos(prefix, "/");
+		if !position {
+			return false;
+		}
+
+		return substr(prefix, 0, position + 1);
+	}
+
+	/**
+	 * Returns the routes that can match an URI using the compiled lookup tables,
+	 * the routes are ordered by their position in the router
+	 */
+	protected function _getCandidateRoutes(string! uri) -> array
+	{
+		var compiledRoutes, candidates, bucket, parts, prefix;
+		int position, total;
+
+		if typeof this->_compiledRoutes != "array" {
+			this->compileRoutes();
+		}
+
+		let compiledRoutes = this->_compiledRoutes,
+			candidates = compiledRoutes["fallback"];
+
+		if fetch bucket, compiledRoutes["static"][uri] {
+			let candidates = array_replace(candidates, bucket);
+		}
+
+		/**
+		 * Walk the complete segments of the URI: /a/, /a/b/, ...
+		 */
+		if count(compiledRoutes["prefixed"]) && starts_with(uri, "/") {
+
+			let parts = explode("/", uri),
+				total = count(parts) - 1,
+				prefix = "/",
+				position = 1;
+
+			while position < total {
+				let prefix .= parts[position] . "/";
+				if fetch bucket, compiledRoutes["prefixed"][prefix] {
+					let candidates = array_replace(candidates, bucket);
+				}
+				let position++;
+			}
+		}
+
+		ksort(candidates);
+
+		return candidates;
+	}
+
 	/**
 	 * Set whether router must remove the extra slashes in the handled routes
 	 */
@@ -321,7 +512,7 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 	 */
 	public function handle(string uri = null)
 	{
-		var realUri, request, currentHostName, routeFound, parts,
+		var realUri, routes, request, currentHostName, routeFound, parts,
 			params, matches, notFoundPaths,
 			vnamespace, module,  controller, action, paramsStr, strParams,
 			route, methods, dependencyInjector,
@@ -361,10 +552,20 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 			eventsManager->fire("router:beforeCheckRoutes", this);
 		}
 
+		/**
+		 * In compiled mode only the routes that can match the URI are checked. The events
+		 * manager must be notified about every route so it falls back to the full traversal
+		 */
+		if this->_useCompiledRoutes && typeof eventsManager != "object" {
+			let routes = this->_getCandidateRoutes(handledUri);
+		} else {
+			let routes = this->_routes;
+		}
+
 		/**
 		 * Routes are traversed in reversed order
 		 */
-		for route in reverse this->_routes {
+		for route in reverse routes {
 			let params = [],
 				matches = null;
 
@@ -683,6 +884,9 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 				throw new Exception("Invalid route position");
 		}
 
+		let this->_compiledRoutes = null,
+			this->_routesByName = null;
+
 		return route;
 	}
 
@@ -782,6 +986,9 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 			let this->_routes = groupRoutes;
 		}
 
+		let this->_compiledRoutes = null,
+			this->_routesByName = null;
+
 		return this;
 	}
 
@@ -797,12 +1004,64 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 		return this;
 	}
 
+	/**
+	 * Exports the routes with their compiled patterns, paths, converters, hostnames and
+	 * methods to an array that can be stored in a PHP file and loaded with importRoutes().
+	 * Routes using closures (Before-Match callbacks, converters) can't be exported and the
+	 * groups the routes were mounted from aren't kept
+	 *
+	 *<code>
+	 *	file_put_contents('app/cache/routes.php', '<?php return ' . var_export($router->exportRoutes(), true) . ';');
+	 *</code>
+	 */
+	public function exportRoutes() -> array
+	{
+		var routes, route;
+
+		let routes = [];
+
+		/**
+		 * Routes with closures throw an exception
+		 */
+		for route in this->_routes {
+			let routes[] = route->toArray();
+		}
+
+		return routes;
+	}
+
+	/**
+	 * Replaces the routes of the router with routes exported by exportRoutes(), the
+	 * patterns aren't compiled again
+	 *
+	 *<code>
+	 *	$router->importRoutes(require 'app/cache/routes.php');
+	 *</code>
+	 */
+	public function importRoutes(array! routes) -> <RouterInterface>
+	{
+		var data, importedRoutes;
+
+		let importedRoutes = [];
+		for data in routes {
+			let importedRoutes[] = Route::__set_state(data);
+		}
+
+		let this->_routes = importedRoutes,
+			this->_compiledRoutes = null,
+			this->_routesByName = null;
+
+		return this;
+	}
+
 	/**
 	 * Removes all the pre-defined routes
 	 */
 	public function clear() -> void
 	{
-		let this->_routes = [];
+		let this->_routes = [],
+			this->_compiledRoutes = null,
+			this->_routesByName = null;
 	}
 
 	/**
@@ -884,10 +1143,12 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 	{
 		var route;
 
-		for route in this->_routes {
-			if route->getRouteId() == id {
-				return route;
-			}
+		if this->_routesByName === null || this->_namesVersion !== Route::getNamesVersion() {
+			this->_indexRoutes();
+		}
+
+		if fetch route, this->_routesById[id] {
+			return route;
 		}
 
 		return false;
@@ -900,14 +1161,43 @@ class Router implements InjectionAwareInterface, RouterInterface, EventsAwareInt
 	{
 		var route;
 
-		for route in this->_routes {
-			if route->getName() == name {
-				return route;
-			}
+		if this->_routesByName === null || this->_namesVersion !== Route::getNamesVersion() {
+			this->_indexRoutes();
 		}
+
+		if fetch route, this->_routesByName[name] {
+			return route;
+		}
+
 		return false;
 	}
 
+	/**
+	 * Indexes the routes by id and name. The index is rebuilt after routes are added and
+	 * after any route is named, the first route with a given name wins
+	 */
+	protected function _indexRoutes() -> void
+	{
+		var routesByName, routesById, route, name;
+
+		let routesByName = [],
+			routesById = [];
+
+		if typeof this->_routes == "array" {
+			for route in this->_routes {
+				let routesById[route->getRouteId()] = route,
+					name = route->getName();
+				if name !== null && !isset routesByName[name] {
+					let routesByName[name] = route;
+				}
+			}
+		}
+
+		let this->_routesByName = routesByName,
+			this->_routesById = routesById,
+			this->_namesVersion = Route::getNamesVersion();
+	}
+
 	/**
 	 * Returns whether controller name should not be mangled
 	 */
@@ -52,6 +52,8 @@ class Annotations extends Router
 
 	protected _routePrefix;
 
+	protected _resourcesLoaded = false;
+
 	/**
 	 * Adds a resource to the annotations handler
 	 * A resource is a class that contains routing annotations
@@ -80,11 +82,7 @@ class Annotations extends Router
 	 */
 	public function handle(string! uri = null)
 	{
-		var realUri, annotationsService, handlers, controllerSuffix,
-			scope, prefix, dependencyInjector, handler, controllerName,
-			lowerControllerName, namespaceName, moduleName, sufixed, handlerAnnotations,
-			classAnnotations, annotations, annotation, methodAnnotations, lowercased, method,
-			collection;
+		var realUri, handlers, scope, prefix;
 
 		if !uri {
 			/**
@@ -95,12 +93,11 @@ class Annotations extends Router
 			let realUri = uri;
 		}
 
-		let annotationsService = null;
-
+		/**
+		 * Routes loaded by loadResources() or importRoutes() are not read again
+		 */
 		let handlers = this->_handlers;
-		if typeof handlers == "array" {
-
-			let controllerSuffix = this->_controllerSuffix;
+		if typeof handlers == "array" && !this->_resourcesLoaded {
 
 			for scope in handlers {
 
@@ -117,95 +114,145 @@ class Annotations extends Router
 						}
 					}
 
-					if typeof annotationsService != "object" {
+					this->_processResource(scope);
+				}
+			}
+		}
+
+		/**
+		 * Call the parent handle method()
+		 */
+		parent::handle(realUri);
+	}
 
-						let dependencyInjector = <DiInterface> this->_dependencyInjector;
-						if typeof dependencyInjector != "object" {
-							throw new Exception("A dependency injection container is required to access the 'annotations' service");
-						}
+	/**
+	 * Adds the routes of every resource regardless of the handled URI, this is used to
+	 * build the whole route table in order to export it
+	 *
+	 *<code>
+	 *	$router->loadResources();
+	 *	file_put_contents('app/cache/routes.php', '<?php return ' . var_export($router->exportRoutes(), true) . ';');
+	 *</code>
+	 */
+	public function loadResources() -> <Annotations>
+	{
+		var handlers, scope;
+
+		if !this->_resourcesLoaded {
 
-						let annotationsService = dependencyInjector->getShared("annotations");
+			let handlers = this->_handlers;
+			if typeof handlers == "array" {
+				for scope in handlers {
+					if typeof scope == "array" {
+						this->_processResource(scope);
 					}
+				}
+			}
 
-					/**
-					 * The controller must be in position 1
-					 */
-					let handler = scope[1];
+			let this->_resourcesLoaded = true;
+		}
 
-					if memstr(handler, "\\") {
+		return this;
+	}
 
-						/**
-						 * Extract the real class name from the namespaced class
-						 * The lowercased class name is used as controller
-						 * Extract the namespace from the namespaced class
-						 */
-						let controllerName = get_class_ns(handler),
-							lowerControllerName = uncamelize(controllerName),
-							namespaceName = get_ns_class(handler);
+	/**
+	 * Replaces the routes with exported routes, the resources are not read anymore
+	 */
+	public function importRoutes(array! routes) -> <Annotations>
+	{
+		parent::importRoutes(routes);
+		let this->_resourcesLoaded = true;
+		return this;
+	}
 
-					} else {
-						let controllerName = handler,
-							lowerControllerName = uncamelize(controllerName),
-							namespaceName = null;
-					}
+	/**
+	 * Reads the annotations of a resource adding its routes
+	 */
+	protected function _processResource(array! scope) -> void
+	{
+		var annotationsService, controllerSuffix, dependencyInjector, handler, controllerName,
+			lowerControllerName, namespaceName, moduleName, sufixed, handlerAnnotations,
+			classAnnotations, annotations, annotation, methodAnnotations, lowercased, method,
+			collection;
 
-					let this->_routePrefix = null;
+		let dependencyInjector = <DiInterface> this->_dependencyInjector;
+		if typeof dependencyInjector != "object" {
+			throw new Exception("A dependency injection container is required to access the 'annotations' service");
+		}
 
-					/**
-					 * Check if the scope has a module associated
-					 */
-					fetch moduleName, scope[2];
+		let annotationsService = dependencyInjector->getShared("annotations"),
+			controllerSuffix = this->_controllerSuffix;
 
-					let sufixed = handler . controllerSuffix;
+		/**
+		 * The controller must be in position 1
+		 */
+		let handler = scope[1];
 
-					/**
-					 * Get the annotations from the class
-					 */
-					let handlerAnnotations = annotationsService->get(sufixed);
+		if memstr(handler, "\\") {
 
-					/**
-					 * Process class annotations
-					 */
-					if typeof handlerAnnotations == "object" {
-
-						let classAnnotations = handlerAnnotations->getClassAnnotations();
-						if typeof classAnnotations == "object" {
-
-							/**
-							 * Process class annotations
-							 */
-							let annotations = classAnnotations->getAnnotations();
-							if typeof annotations == "array" {
-								for annotation in annotations {
-									this->processControllerAnnotation(controllerName, annotation);
-								}
-							}
-						}
+			/**
+			 * Extract the real class name from the namespaced class
+			 * The lowercased class name is used as controller
+			 * Extract the namespace from the namespaced class
+			 */
+			let controllerName = get_class_ns(handler),
+				lowerControllerName = uncamelize(controllerName),
+				namespaceName = get_ns_class(handler);
 
-						/**
-						 * Process method annotations
-						 */
-						let methodAnnotations = handlerAnnotations->getMethodsAnnotations();
-						if typeof methodAnnotations == "array" {
-							let lowercased = uncamelize(handler);
-							for method, collection in methodAnnotations {
-								if typeof collection == "object" {
-									for annotation in collection->getAnnotations() {
-										this->processActionAnnotation(moduleName, namespaceName, lowerControllerName, method, annotation);
-									}
-								}
-							}
-						}
+		} else {
+			let controllerName = handler,
+				lowerControllerName = uncamelize(controllerName),
+				namespaceName = null;
+		}
+
+		let this->_routePrefix = null;
+
+		/**
+		 * Check if the scope has a module associated
+		 */
+		fetch moduleName, scope[2];
+
+		let sufixed = handler . controllerSuffix;
+
+		/**
+		 * Get the annotations from the class
+		 */
+		let handlerAnnotations = annotationsService->get(sufixed);
+
+		/**
+		 * Process class annotations
+		 */
+		if typeof handlerAnnotations == "object" {
+
+			let classAnnotations = handlerAnnotations->getClassAnnotations();
+			if typeof classAnnotations == "object" {
+
+				/**
+				 * Process class annotations
+				 */
+				let annotations = classAnnotations->getAnnotations();
+				if typeof annotations == "array" {
+					for annotation in annotations {
+						this->processControllerAnnotation(controllerName, annotation);
 					}
+				}
+			}
 
+			/**
+			 * Process method annotations
+			 */
+			let methodAnnotations = handlerAnnotations->getMethodsAnnotations();
+			if typeof methodAnnotations == "array" {
+				let lowercased = uncamelize(handler);
+				for method, collection in methodAnnotations {
+					if typeof collection == "object" {
+						for annotation in collection->getAnnotations() {
+							this->processActionAnnotation(moduleName, namespaceName, lowerControllerName, method, annotation);
+						}
+					}
 				}
 			}
 		}
-
-		/**
-		 * Call the parent handle method()
-		 */
-		parent::handle(realUri);
 	}
 
 	/**
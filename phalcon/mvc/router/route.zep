@@ -49,8 +49,15 @@ class Route implements RouteInterface
 
 	protected _group;
 
+	protected _reversedTemplate;
+
 	protected static _uniqueId;
 
+	/**
+	 * Changes every time a route is named, so routers know their name index is outdated
+	 */
+	protected static _namesVersion = 0;
+
 	/**
 	 * Phalcon\Mvc\Router\Route constructor
 	 */
@@ -324,7 +331,8 @@ class Route implements RouteInterface
 		/**
 		 * Update the route's paths
 		 */
-		let this->_paths = routePaths;
+		let this->_paths = routePaths,
+			this->_reversedTemplate = null;
 	}
 
 	/**
@@ -433,10 +441,22 @@ class Route implements RouteInterface
 	 */
 	public function setName(string name) -> <Route>
 	{
-		let this->_name = name;
+		var namesVersion;
+
+		let namesVersion = self::_namesVersion,
+			this->_name = name,
+			self::_namesVersion = namesVersion + 1;
 		return this;
 	}
 
+	/**
+	 * Returns a counter that changes every time a route is named
+	 */
+	public static function getNamesVersion() -> int
+	{
+		return self::_namesVersion;
+	}
+
 	/**
 	 * Sets a callback that is called if the route is matched.
 	 * The developer can implement any arbitrary conditions here
@@ -502,6 +522,22 @@ class Route implements RouteInterface
 		return reversed;
 	}
 
+	/**
+	 * Returns the pattern split into its literal parts and the names of the parameters that fill
+	 * its placeholders, the template is built once and used by Phalcon\Mvc\Url to generate URIs
+	 */
+	public function getReversedTemplate() -> array
+	{
+		var template;
+
+		let template = this->_reversedTemplate;
+		if typeof template != "array" {
+			let template = phalcon_reverse_template(this->_pattern, this->getReversedPaths()),
+				this->_reversedTemplate = template;
+		}
+		return template;
+	}
+
 	/**
 	 * Sets a set of HTTP methods that constraint the matching of the route (alias of via)
 	 *
@@ -579,6 +615,28 @@ class Route implements RouteInterface
 		return this->_converters;
 	}
 
+	/**
+	 * Checks whether a value can be restored from var_export(), which isn't the case for objects
+	 */
+	protected function _isExportable(var value) -> boolean
+	{
+		var item;
+
+		if typeof value == "object" {
+			return false;
+		}
+
+		if typeof value == "array" {
+			for item in value {
+				if !this->_isExportable(item) {
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
 	/**
 	 * Resets the internal route id generator
 	 */
@@ -586,4 +644,105 @@ class Route implements RouteInterface
 	{
 		let self::_uniqueId = null;
 	}
+
+	/**
+	 * Returns the state of the route, it can be restored with Phalcon\Mvc\Router\Route::__set_state.
+	 * Routes with objects in their state (e.g. Before-Match or converter closures) can't be exported.
+	 * The group the route belongs to isn't kept
+	 */
+	public function toArray() -> array
+	{
+		var converters, name, converter;
+
+		/**
+		 * Closures and other objects can't be restored from var_export()
+		 */
+		if typeof this->_beforeMatch == "object" {
+			throw new Exception("Routes with a Before-Match closure cannot be exported ('" . this->_pattern . "')");
+		}
+
+		let converters = this->_converters;
+		if typeof converters == "array" {
+			for name, converter in converters {
+				if !this->_isExportable(converter) {
+					throw new Exception("The converter '" . name . "' of the route '" . this->_pattern . "' cannot be exported");
+				}
+			}
+		}
+
+		if !this->_isExportable(this->_paths) || !this->_isExportable(this->_methods) || !this->_isExportable(this->_hostname) {
+			throw new Exception("The route '" . this->_pattern . "' contains values that cannot be exported");
+		}
+
+		return [
+			"pattern": this->_pattern,
+			"compiledPattern": this->_compiledPattern,
+			"paths": this->_paths,
+			"methods": this->_methods,
+			"hostname": this->_hostname,
+			"converters": this->_converters,
+			"id": this->_id,
+			"name": this->_name,
+			"beforeMatch": this->_beforeMatch
+		];
+	}
+
+	/**
+	 * Restores a route exported by Phalcon\Mvc\Router\Route::toArray without compiling its pattern again
+	 */
+	public static function __set_state(array! data) -> <Route>
+	{
+		var route, value, routeId;
+
+		/**
+		 * Patterns starting with '#' are used as they are
+		 */
+		let route = new self("#");
+
+		if fetch value, data["pattern"] {
+			let route->_pattern = value;
+		}
+
+		if fetch value, data["compiledPattern"] {
+			let route->_compiledPattern = value;
+		}
+
+		if fetch value, data["paths"] {
+			let route->_paths = value;
+		}
+
+		if fetch value, data["methods"] {
+			let route->_methods = value;
+		}
+
+		if fetch value, data["hostname"] {
+			let route->_hostname = value;
+		}
+
+		if fetch value, data["converters"] {
+			let route->_converters = value;
+		}
+
+		if fetch value, data["name"] {
+			let route->_name = value;
+		}
+
+		if fetch value, data["beforeMatch"] {
+			let route->_beforeMatch = value;
+		}
+
+		/**
+		 * Keep the original id, new routes must not reuse it
+		 */
+		if fetch routeId, data["id"] {
+			if routeId !== null {
+				let route->_id = routeId;
+				if self::_uniqueId <= routeId {
+					let self::_uniqueId = routeId + 1;
+				}
+			}
+		}
+
+		return route;
+	}
 }
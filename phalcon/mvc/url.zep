@@ -24,6 +24,7 @@ use Phalcon\Mvc\UrlInterface;
 use Phalcon\Mvc\Url\Exception;
 use Phalcon\Mvc\RouterInterface;
 use Phalcon\Mvc\Router\RouteInterface;
+use Phalcon\Mvc\Router\Route;
 use Phalcon\Di\InjectionAwareInterface;
 
 /**
@@ -230,9 +231,13 @@ class Url implements UrlInterface, InjectionAwareInterface
 			}
 
 			/**
-			 * Replace the patterns by its variables
+			 * Replace the patterns by its variables, the framework routes keep the pattern already parsed
 			 */
-			let uri = phalcon_replace_paths(route->getPattern(), route->getReversedPaths(), uri);
+			if route instanceof Route {
+				let uri = phalcon_fill_template(route->getReversedTemplate(), uri);
+			} else {
+				let uri = phalcon_replace_paths(route->getPattern(), route->getReversedPaths(), uri);
+			}
 		}
 
 		if local {
@@ -84,6 +84,11 @@ class Compiler implements InjectionAwareInterface
 
 	protected _compiledTemplatePath;
 
+	/**
+	 * Loaded manifests indexed by manifest path
+	 */
+	protected static _manifests;
+
 	/**
 	 * Phalcon\Mvc\View\Engine\Volt\Compiler
 	 */
@@ -2399,7 +2404,8 @@ class Compiler implements InjectionAwareInterface
 	{
 		var stat, compileAlways, prefix, compiledPath, compiledSeparator, blocksCode,
 			compiledExtension, compilation, options, realCompiledPath,
-			compiledTemplatePath, templateSepPath;
+			compiledTemplatePath, templateSepPath, manifest, manifestKey,
+			manifestEntry, templates, manifestPath;
 
 		/**
 		 * Re-initialize some properties already initialized when the object is cloned
@@ -2412,6 +2418,24 @@ class Compiler implements InjectionAwareInterface
 		let this->_blockLevel = 0;
 		let this->_exprLevel = 0;
 
+		/**
+		 * Templates already indexed in the manifest are resolved without touching the filesystem
+		 */
+		let manifest = this->getManifest();
+		if typeof manifest == "array" {
+			if extendsMode === true {
+				let manifestKey = templatePath . "%%e";
+			} else {
+				let manifestKey = templatePath;
+			}
+			if !this->getOption("compileAlways") {
+				if fetch manifestEntry, manifest["templates"][manifestKey] {
+					let this->_compiledTemplatePath = manifestEntry[0];
+					return manifestEntry[1];
+				}
+			}
+		}
+
 		let stat = true;
 		let compileAlways = false;
 		let compiledPath = "";
@@ -2595,9 +2619,158 @@ class Compiler implements InjectionAwareInterface
 
 		let this->_compiledTemplatePath = realCompiledPath;
 
+		/**
+		 * Index the template in the manifest, blocks are stored only for templates compiled in extends mode
+		 */
+		if typeof manifest == "array" {
+			if extendsMode !== true || typeof compilation == "array" {
+				/**
+				 * Sub-compilers could have indexed included or extended templates meanwhile
+				 */
+				let manifest = this->getManifest(),
+					manifestPath = options["manifest"],
+					templates = manifest["templates"];
+				if extendsMode === true {
+					let templates[manifestKey] = [realCompiledPath, compilation];
+				} else {
+					let templates[manifestKey] = [realCompiledPath, null];
+				}
+				let manifest["templates"] = templates,
+					self::_manifests[manifestPath] = manifest;
+			}
+		}
+
 		return compilation;
 	}
 
+	/**
+	 * Returns the manifest of compiled templates set in the 'manifest' option.
+	 * The manifest is read once per request and discarded if its version doesn't
+	 * match the 'manifestVersion' option
+	 *
+	 * @return array|null
+	 */
+	public function getManifest()
+	{
+		var options, manifestPath, manifest, version;
+
+		let options = this->_options;
+		if typeof options != "array" {
+			return null;
+		}
+
+		if !fetch manifestPath, options["manifest"] {
+			return null;
+		}
+
+		if typeof manifestPath != "string" {
+			throw new Exception("'manifest' must be a string");
+		}
+
+		if !fetch version, options["manifestVersion"] {
+			let version = "";
+		}
+
+		if fetch manifest, self::_manifests[manifestPath] {
+			if typeof manifest == "array" && manifest["version"] === version {
+				return manifest;
+			}
+		}
+
+		let manifest = null;
+		if file_exists(manifestPath) {
+			let manifest = require manifestPath;
+		}
+
+		if typeof manifest != "array" || !isset manifest["version"] || manifest["version"] !== version || !isset manifest["templates"] {
+			let manifest = ["version": version, "templates": []];
+		}
+
+		let self::_manifests[manifestPath] = manifest;
+		return manifest;
+	}
+
+	/**
+	 * Writes the manifest of compiled templates to the path set in the 'manifest' option
+	 */
+	public function saveManifest() -> boolean
+	{
+		var manifest, manifestPath;
+
+		let manifest = this->getManifest();
+		if typeof manifest != "array" {
+			throw new Exception("The 'manifest' option is required to save the manifest");
+		}
+
+		let manifestPath = this->_options["manifest"];
+
+		/**
+		 * Always use file_put_contents to write files instead of write the file directly, this respect the open_basedir directive
+		 */
+		if file_put_contents(manifestPath, "<?php return " . var_export(manifest, true) . "; ") === false {
+			throw new Exception("Volt manifest " . manifestPath . " can't be written");
+		}
+
+		return true;
+	}
+
+	/**
+	 * Compiles every template in a directory and its subdirectories, the compiled templates
+	 * and their blocks are indexed in the manifest when the 'manifest' option is set.
+	 * Returns the list of compiled templates
+	 *
+	 *<code>
+	 *	$compiler->setOptions(['compiledPath' => 'cache/volt/', 'manifest' => 'cache/volt/manifest.php', 'manifestVersion' => $release]);
+	 *	$compiler->compileAll('app/views/');
+	 *</code>
+	 */
+	public function compileAll(string! directory, string! extension = ".volt") -> array
+	{
+		var options, compileAlways, iterator, file, path, version, compiled;
+
+		let options = this->_options;
+		if typeof options != "array" {
+			let options = [];
+		}
+
+		/**
+		 * The manifest is rebuilt from scratch, so deleted or renamed templates are dropped from it
+		 */
+		if fetch path, options["manifest"] {
+			if typeof path != "string" {
+				throw new Exception("'manifest' must be a string");
+			}
+			if !fetch version, options["manifestVersion"] {
+				let version = "";
+			}
+			let self::_manifests[path] = ["version": version, "templates": []];
+		}
+
+		if !fetch compileAlways, options["compileAlways"] {
+			let compileAlways = false;
+		}
+
+		let this->_options["compileAlways"] = true,
+			compiled = [];
+
+		let iterator = new \RecursiveIteratorIterator(new \RecursiveDirectoryIterator(directory, \FilesystemIterator::SKIP_DOTS));
+		for file in iterator {
+			let path = file->getPathname();
+			if ends_with(path, extension) {
+				this->compile(path);
+				let compiled[] = path;
+			}
+		}
+
+		let this->_options["compileAlways"] = compileAlways;
+
+		if isset options["manifest"] {
+			this->saveManifest();
+		}
+
+		return compiled;
+	}
+
 	/**
 	 * Returns the path that is currently being compiled
 	 */
@@ -0,0 +1,376 @@
+
+/*
+ +------------------------------------------------------------------------+
+ | Phalcon Framework                                                      |
+ +------------------------------------------------------------------------+
+ | Copyright (c) 2011-2015 Phalcon Team (http://www.phalconphp.com)       |
+ +------------------------------------------------------------------------+
+ | This source file is subject to the New BSD License that is bundled     |
+ | with this package in the file docs/LICENSE.txt.                        |
+ |                                                                        |
+ | If you did not receive a copy of the license and are unable to         |
+ | obtain it through the world-wide-web, please send an email             |
+ | to license@phalconphp.com so we can send you a copy immediately.       |
+ +------------------------------------------------------------------------+
+ | Authors: Andres Gutierrez <andres@phalconphp.com>                      |
+ |          Eduar Carvajal <eduar@phalconphp.com>                         |
+ +------------------------------------------------------------------------+
+ */
+
+namespace Phalcon\Paginator\Adapter;
+
+use Phalcon\Mvc\Model\Query\Builder;
+use Phalcon\Paginator\Adapter;
+use Phalcon\Paginator\AdapterInterface;
+use Phalcon\Paginator\Exception;
+
+/**
+ * Phalcon\Paginator\Adapter\Keyset
+ *
+ * Keyset (seek) pagination using a PHQL query builder as source of data. Instead of an
+ * offset the pages are located by the values of an ordered set of unique columns of the
+ * last (or first) row shown, so every page costs the same no matter how deep it is.
+ * The positions are passed around as opaque cursors
+ *
+ *<code>
+ *  $builder = $this->modelsManager->createBuilder()
+ *                   ->columns('id, name, createdAt')
+ *                   ->from('Robots');
+ *
+ *  $paginator = new Phalcon\Paginator\Adapter\Keyset(array(
+ *      "builder" => $builder,
+ *      "columns" => array("createdAt" => "DESC", "id" => "DESC"),
+ *      "limit"   => 20,
+ *      "cursor"  => $this->request->getQuery("cursor")
+ *  ));
+ *
+ *  $page = $paginator->getPaginate();
+ *
+ *  // $page->next and $page->before are the cursors of the following and previous pages
+ *</code>
+ */
+class Keyset extends Adapter implements AdapterInterface
+{
+	/**
+	 * Configuration of paginator
+	 */
+	protected _config;
+
+	/**
+	 * Paginator's data
+	 */
+	protected _builder;
+
+	/**
+	 * Columns the rows are sorted by and their directions
+	 */
+	protected _columns;
+
+	/**
+	 * Cursor of the current page
+	 */
+	protected _cursor;
+
+	/**
+	 * Phalcon\Paginator\Adapter\Keyset
+	 */
+	public function __construct(array config)
+	{
+		var builder, limit, columns, cursor, column, direction, sortColumns;
+
+		let this->_config = config;
+
+		if !fetch builder, config["builder"] {
+			throw new Exception("Parameter 'builder' is required");
+		}
+
+		if !fetch limit, config["limit"] {
+			throw new Exception("Parameter 'limit' is required");
+		}
+
+		if !fetch columns, config["columns"] {
+			throw new Exception("Parameter 'columns' is required");
+		}
+
+		if typeof columns != "array" {
+			let columns = [columns];
+		}
+
+		/**
+		 * Columns without a direction are sorted in ascending order
+		 */
+		let sortColumns = [];
+		for column, direction in columns {
+			if typeof column == "integer" {
+				let sortColumns[direction] = "ASC";
+			} else {
+				let direction = strtoupper(direction);
+				if direction != "ASC" && direction != "DESC" {
+					throw new Exception("The direction of the column '" . column . "' must be ASC or DESC");
+				}
+				let sortColumns[column] = direction;
+			}
+		}
+
+		if !count(sortColumns) {
+			throw new Exception("Parameter 'columns' must have at least one column");
+		}
+
+		let this->_builder = builder,
+			this->_columns = sortColumns;
+
+		this->setLimit(limit);
+
+		if fetch cursor, config["cursor"] {
+			this->setCursor(cursor);
+		}
+	}
+
+	/**
+	 * Sets the cursor of the page to show, null shows the first page
+	 */
+	public function setCursor(var cursor) -> <Keyset>
+	{
+		if cursor === "" {
+			let cursor = null;
+		}
+
+		let this->_cursor = cursor;
+		return this;
+	}
+
+	/**
+	 * Returns the cursor of the current page
+	 */
+	public function getCursor() -> string | null
+	{
+		return this->_cursor;
+	}
+
+	/**
+	 * Set query builder object
+	 */
+	public function setQueryBuilder(<Builder> builder) -> <Keyset>
+	{
+		let this->_builder = builder;
+
+		return this;
+	}
+
+	/**
+	 * Get query builder object
+	 */
+	public function getQueryBuilder() -> <Builder>
+	{
+		return this->_builder;
+	}
+
+	/**
+	 * Returns a page of rows and the cursors to reach the adjacent pages
+	 */
+	public function getPaginate() -> <\stdClass>
+	{
+		var builder, totalBuilder, columns, column, direction, cursor, decoded, backwards,
+			values, conditions, equalities, condition, bindParams, orders, position, items,
+			resultset, row, limit, hasMore, page, total, totalQuery, result, groups,
+			groupColumn, first, last;
+		boolean ascending;
+
+		let builder = clone this->_builder,
+			columns = this->_columns,
+			limit = (int) this->_limitRows,
+			cursor = this->_cursor,
+			backwards = false,
+			values = null;
+
+		if limit < 1 {
+			throw new Exception("The limit must be greater than zero");
+		}
+
+		if cursor !== null {
+			let decoded = this->decodeCursor(cursor);
+			let backwards = decoded[0] == "p",
+				values = decoded[1];
+		}
+
+		/**
+		 * The rows after (or before) the cursor: (a > :a) OR (a = :a AND b > :b) ...
+		 */
+		if typeof values == "array" {
+
+			let conditions = [],
+				equalities = "",
+				bindParams = [],
+				position = 0;
+
+			for column, direction in columns {
+
+				if !array_key_exists(position, values) {
+					throw new Exception("The cursor doesn't match the paginator columns");
+				}
+
+				let ascending = direction == "ASC";
+				if backwards {
+					let ascending = !ascending;
+				}
+
+				if ascending {
+					let condition = column . " > :KS" . position . ":";
+				} else {
+					let condition = column . " < :KS" . position . ":";
+				}
+
+				let conditions[] = "(" . equalities . condition . ")",
+					equalities .= column . " = :KS" . position . ": AND ",
+					bindParams["KS" . position] = values[position],
+					position++;
+			}
+
+			builder->andWhere(implode(" OR ", conditions), bindParams);
+		}
+
+		/**
+		 * Pages before the cursor are read in reverse order
+		 */
+		let orders = [];
+		for column, direction in columns {
+			if backwards {
+				let direction = direction == "ASC" ? "DESC" : "ASC";
+			}
+			let orders[] = column . " " . direction;
+		}
+
+		/**
+		 * One extra row tells if there are more rows in the same direction
+		 */
+		builder->orderBy(implode(", ", orders));
+		builder->limit(limit + 1);
+
+		let resultset = builder->getQuery()->execute(),
+			items = [];
+		for row in resultset {
+			let items[] = row;
+		}
+
+		let hasMore = count(items) > limit;
+		if hasMore {
+			array_pop(items);
+		}
+
+		if backwards {
+			let items = array_reverse(items);
+		}
+
+		let page = new \stdClass(),
+			page->items = items,
+			page->current = cursor,
+			page->before = null,
+			page->next = null,
+			page->limit = limit;
+
+		if count(items) {
+
+			let first = items[0],
+				last = items[count(items) - 1];
+
+			/**
+			 * Moving forward there are previous rows if a cursor was given, moving backwards
+			 * there are following rows
+			 */
+			if backwards {
+				if hasMore {
+					let page->before = this->encodeCursor("p", first);
+				}
+				let page->next = this->encodeCursor("n", last);
+			} else {
+				if cursor !== null {
+					let page->before = this->encodeCursor("p", first);
+				}
+				if hasMore {
+					let page->next = this->encodeCursor("n", last);
+				}
+			}
+		}
+
+		/**
+		 * The total is optional: a known (e.g. cached or estimated) total can be passed in
+		 * the 'total' parameter or an exact COUNT requested with 'count'
+		 */
+		let total = null;
+		if !fetch total, this->_config["total"] {
+			if isset this->_config["count"] && this->_config["count"] {
+
+				let totalBuilder = clone this->_builder;
+				totalBuilder->columns("COUNT(*) [rowcount]");
+
+				let groups = totalBuilder->getGroupBy();
+				if !empty groups {
+					if typeof groups == "array" {
+						let groupColumn = implode(", ", groups);
+					} else {
+						let groupColumn = groups;
+					}
+					totalBuilder->groupBy(null)->columns(["COUNT(DISTINCT " . groupColumn . ") AS rowcount"]);
+				}
+
+				totalBuilder->orderBy(null);
+
+				let totalQuery = totalBuilder->getQuery(),
+					result = totalQuery->execute()->getFirst(),
+					total = result ? intval(result->rowcount) : 0;
+			}
+		}
+
+		let page->total_items = total;
+
+		return page;
+	}
+
+	/**
+	 * Builds the opaque cursor of a row
+	 */
+	protected function encodeCursor(string! type, var row) -> string
+	{
+		var column, values, name, position;
+
+		let values = [];
+		for column, _ in this->_columns {
+
+			/**
+			 * Qualified columns (Robots.id) are read from the row by their name (id)
+			 */
+			let position = strrpos(column, ".");
+			if position !== false {
+				let name = substr(column, position + 1);
+			} else {
+				let name = column;
+			}
+
+			let name = trim(name, "[]");
+
+			if typeof row == "array" {
+				let values[] = row[name];
+			} else {
+				let values[] = row->{name};
+			}
+		}
+
+		return rtrim(strtr(base64_encode(json_encode([type, values])), "+/", "-_"), "=");
+	}
+
+	/**
+	 * Decodes a cursor returning its direction and column values
+	 */
+	protected function decodeCursor(string! cursor) -> array
+	{
+		var decoded;
+
+		let decoded = json_decode(base64_decode(strtr(cursor, "-_", "+/")), true);
+
+		if typeof decoded != "array" || count(decoded) != 2 || typeof decoded[1] != "array" || (decoded[0] !== "n" && decoded[0] !== "p") {
+			throw new Exception("The cursor is not valid");
+		}
+
+		return decoded;
+	}
+}
@@ -35,6 +35,7 @@ use Phalcon\Queue\Beanstalk\Exception;
  *     'host'       => '127.0.0.1',
  *     'port'       => 11300,
  *     'persistent' => true,
+ *     'serializer' => 'json', // php (default), igbinary, json or raw
  * ]);
  * </code>
  *
@@ -46,6 +47,11 @@ class Beanstalk
 
 	protected _parameters;
 
+	/**
+	 * How job bodies are encoded: php, igbinary, json or raw
+	 */
+	protected _serializer = "php";
+
 	/**
 	 * Phalcon\Queue\Beanstalk
 	 *
@@ -69,6 +75,10 @@ class Beanstalk
 			let parameters["port"] = 11300;
 		}
 
+		if isset parameters["serializer"] {
+			this->setSerializer(parameters["serializer"]);
+		}
+
 		let this->_parameters = parameters;
 	}
 
@@ -112,12 +122,109 @@ class Beanstalk
 		return connection;
 	}
 
+	/**
+	 * Changes how job bodies are encoded: "php" (serialize), "igbinary", "json" or "raw".
+	 * Raw bodies are sent as strings and returned as they were received
+	 */
+	public function setSerializer(string! serializer) -> <Beanstalk>
+	{
+		switch serializer {
+
+			case "php":
+			case "json":
+			case "raw":
+				break;
+
+			case "igbinary":
+				if !function_exists("igbinary_serialize") {
+					throw new Exception("The igbinary extension is required by the igbinary serializer");
+				}
+				break;
+
+			default:
+				throw new Exception("Unknown serializer '" . serializer . "'");
+		}
+
+		let this->_serializer = serializer;
+		return this;
+	}
+
+	/**
+	 * Returns the name of the serializer used for the job bodies
+	 */
+	public function getSerializer() -> string
+	{
+		return this->_serializer;
+	}
+
 	/**
 	 * Inserts jobs into the queue
 	 */
 	public function put(var data, array options = null) -> string|boolean
 	{
-		var priority, delay, ttr, serialized, response, status, length;
+		var response, status;
+
+		/**
+		 * The command and the body are sent in a single packet
+		 */
+		this->write(this->_buildPut(data, options));
+
+		let response = this->readStatus();
+		let status = response[0];
+
+		if status != "INSERTED" && status != "BURIED" {
+			return false;
+		}
+
+		return response[1];
+	}
+
+	/**
+	 * Inserts several jobs into the queue with a single write, then reads their statuses.
+	 * Returns the id of every job, or false for the jobs that weren't inserted, with the same keys
+	 *
+	 *<code>
+	 * $ids = $queue->putMany(['video-1', 'video-2', 'video-3'], ['priority' => 250]);
+	 *</code>
+	 */
+	public function putMany(array! jobs, array options = null) -> array
+	{
+		var data, packet, key, response, status, results;
+
+		if !count(jobs) {
+			return [];
+		}
+
+		let packet = "";
+		for data in jobs {
+			let packet .= this->_buildPut(data, options) . "\r\n";
+		}
+
+		/**
+		 * The last line break is added by write()
+		 */
+		this->write(substr(packet, 0, -2));
+
+		let results = [];
+		for key, _ in jobs {
+			let response = this->readStatus(),
+				status = response[0];
+			if status == "INSERTED" || status == "BURIED" {
+				let results[key] = response[1];
+			} else {
+				let results[key] = false;
+			}
+		}
+
+		return results;
+	}
+
+	/**
+	 * Builds the put command of a job followed by its encoded body
+	 */
+	protected function _buildPut(var data, options) -> string
+	{
+		var priority, delay, ttr, body;
 
 		/**
 		 * Priority is 100 by default
@@ -137,23 +244,55 @@ class Beanstalk
 		/**
 		 * Data is automatically serialized before be sent to the server
 		 */
-		let serialized = serialize(data);
+		let body = this->_encode(data);
 
-		/**
-		 * Create the command
-		 */
-		let length = strlen(serialized);
-		this->write("put " . priority . " " . delay . " " . ttr ." " . length);
-		this->write(serialized);
+		return "put " . priority . " " . delay . " " . ttr . " " . strlen(body) . "\r\n" . body;
+	}
 
-		let response = this->readStatus();
-		let status = response[0];
+	/**
+	 * Encodes a job body with the current serializer
+	 */
+	protected function _encode(var data) -> string
+	{
+		var serializer;
 
-		if status != "INSERTED" && status != "BURIED" {
-			return false;
+		let serializer = this->_serializer;
+		switch serializer {
+
+			case "json":
+				return json_encode(data);
+
+			case "igbinary":
+				return igbinary_serialize(data);
+
+			case "raw":
+				return (string) data;
 		}
 
-		return response[1];
+		return serialize(data);
+	}
+
+	/**
+	 * Decodes a job body with the current serializer
+	 */
+	protected function _decode(var body) -> var
+	{
+		var serializer;
+
+		let serializer = this->_serializer;
+		switch serializer {
+
+			case "json":
+				return json_decode(body, true);
+
+			case "igbinary":
+				return igbinary_unserialize(body);
+
+			case "raw":
+				return body;
+		}
+
+		return unserialize(body);
 	}
 
 	/**
@@ -182,7 +321,88 @@ class Beanstalk
 		 * The body is serialized
 		 * Create a beanstalk job abstraction
 		 */
-		return new Job(this, response[1], unserialize(this->read(response[2])));
+		return new Job(this, response[1], this->_decode(this->read(response[2])));
+	}
+
+	/**
+	 * Reserves up to "limit" jobs with a single write. Only the first reserve waits for the timeout,
+	 * the rest return immediately if the watched tubes have no more ready jobs
+	 *
+	 *<code>
+	 * foreach ($queue->reserveMany(10) as $job) {
+	 *     processVideo($job->getBody());
+	 * }
+	 *</code>
+	 */
+	public function reserveMany(int limit, var timeout = null) -> array
+	{
+		var packet, response, jobs;
+		int i;
+
+		if limit < 1 {
+			return [];
+		}
+
+		if typeof timeout != "null" {
+			let packet = "reserve-with-timeout " . timeout;
+		} else {
+			let packet = "reserve";
+		}
+
+		let i = 1;
+		while i < limit {
+			let packet .= "\r\nreserve-with-timeout 0",
+				i++;
+		}
+
+		this->write(packet);
+
+		let jobs = [],
+			i = 0;
+		while i < limit {
+			let response = this->readStatus();
+			if response[0] == "RESERVED" {
+				let jobs[] = new Job(this, response[1], this->_decode(this->read(response[2])));
+			}
+			let i++;
+		}
+
+		return jobs;
+	}
+
+	/**
+	 * Removes several jobs, given as Phalcon\Queue\Beanstalk\Job objects or ids, with a single write.
+	 * Returns the number of jobs deleted
+	 */
+	public function deleteMany(array! jobs) -> int
+	{
+		var job, packet, response;
+		int deleted;
+
+		if !count(jobs) {
+			return 0;
+		}
+
+		let packet = "";
+		for job in jobs {
+			if typeof job == "object" {
+				let packet .= "delete " . job->getId() . "\r\n";
+			} else {
+				let packet .= "delete " . job . "\r\n";
+			}
+		}
+
+		this->write(substr(packet, 0, -2));
+
+		let deleted = 0;
+		for job in jobs {
+			let response = this->readStatus();
+			if response[0] == "DELETED" {
+				let deleted++;
+			}
+		}
+
+		return deleted;
 	}
 
 	/**
@@ -284,7 +504,7 @@ class Beanstalk
 			return false;
 		}
 
-		return new Job(this, response[1], unserialize(this->read(response[2])));
+		return new Job(this, response[1], this->_decode(this->read(response[2])));
 	}
 
 	/**
@@ -301,7 +521,7 @@ class Beanstalk
 			return false;
 		}
 
-		return new Job(this, response[1], unserialize(this->read(response[2])));
+		return new Job(this, response[1], this->_decode(this->read(response[2])));
 	}
 
 	/**
@@ -385,7 +605,8 @@ class Beanstalk
 	 */
 	protected function write(string data) -> boolean|int
 	{
-		var connection, packet;
+		var connection, packet, written;
+		int length, total;
 
 		let connection = this->_connection;
 		if typeof connection != "resource" {
@@ -395,8 +616,27 @@ class Beanstalk
 			}
 		}
 
-		let packet = data . "\r\n";
-		return fwrite(connection, packet, strlen(packet));
+		let packet = data . "\r\n",
+			length = strlen(packet);
+
+		let written = fwrite(connection, packet, length);
+		if written === false {
+			return false;
+		}
+
+		/**
+		 * Batches may not fit in the socket buffer at once
+		 */
+		let total = written;
+		while total < length {
+			let written = fwrite(connection, substr(packet, total));
+			if !written {
+				return false;
+			}
+			let total += written;
+		}
+
+		return total;
 	}
 
 	/**
@@ -38,6 +38,30 @@ abstract class Adapter
 
 	protected _options;
 
+	/**
+	 * Defer session_start() until the session is used for the first time
+	 */
+	protected _lazyStart = false;
+
+	/**
+	 * The session was started in lazy mode and hasn't been opened yet
+	 */
+	protected _pending = false;
+
+	/**
+	 * Skip writing the session back to the storage if its data didn't change
+	 */
+	protected _lazyWrite = false;
+
+	/**
+	 * Refresh the lifetime of unchanged sessions that aren't written back
+	 */
+	protected _touch = true;
+
+	protected _readId;
+
+	protected _readHash;
+
 	/**
 	 * Phalcon\Session\Adapter constructor
 	 *
@@ -52,11 +76,20 @@ abstract class Adapter
 
 	/**
 	 * Starts the session (if headers are already sent the session will not be started)
+	 *
+	 * With the 'lazyStart' option the session is only opened the first time it's read or
+	 * written through the adapter, so requests that don't use it don't touch the storage.
+	 * $_SESSION isn't available until then. As session_start() still needs to send the
+	 * session cookie, that first use must happen before any output is sent
 	 */
 	public function start() -> boolean
 	{
 		if !headers_sent() {
-			if !this->_started && this->status() !== self::SESSION_ACTIVE {
+			if !this->_started && !this->_pending && this->status() !== self::SESSION_ACTIVE {
+				if this->_lazyStart {
+					let this->_pending = true;
+					return true;
+				}
 				session_start();
 				let this->_started = true;
 				return true;
@@ -74,12 +107,24 @@ abstract class Adapter
 	 */
 	public function setOptions(array! options)
 	{
-		var uniqueId;
+		var uniqueId, lazyStart, lazyWrite, touch;
 
 		if fetch uniqueId, options["uniqueId"] {
 			let this->_uniqueId = uniqueId;
 		}
 
+		if fetch lazyStart, options["lazyStart"] {
+			let this->_lazyStart = (boolean) lazyStart;
+		}
+
+		if fetch lazyWrite, options["lazyWrite"] {
+			let this->_lazyWrite = (boolean) lazyWrite;
+		}
+
+		if fetch touch, options["touch"] {
+			let this->_touch = (boolean) touch;
+		}
+
 		let this->_options = options;
 	}
 
@@ -112,6 +157,10 @@ abstract class Adapter
 	 */
 	public function regenerateId(bool deleteOldSession = true) -> <Adapter>
 	{
+		if this->_pending {
+			this->_open();
+		}
+
 		session_regenerate_id(deleteOldSession);
 		return this;
 	}
@@ -127,6 +176,10 @@ abstract class Adapter
 	{
 		var value, key, uniqueId;
 
+		if this->_pending {
+			this->_open();
+		}
+
 		let uniqueId = this->_uniqueId;
 		if !empty uniqueId {
 			let key = uniqueId . "#" . index;
@@ -155,6 +208,10 @@ abstract class Adapter
 	{
 		var uniqueId;
 
+		if this->_pending {
+			this->_open();
+		}
+
 		let uniqueId = this->_uniqueId;
 		if !empty uniqueId {
 			let _SESSION[uniqueId . "#" . index] = value;
@@ -175,6 +232,10 @@ abstract class Adapter
 	{
 		var uniqueId;
 
+		if this->_pending {
+			this->_open();
+		}
+
 		let uniqueId = this->_uniqueId;
 		if !empty uniqueId {
 			return isset _SESSION[uniqueId . "#" . index];
@@ -194,6 +255,10 @@ abstract class Adapter
 	{
 		var uniqueId;
 
+		if this->_pending {
+			this->_open();
+		}
+
 		let uniqueId = this->_uniqueId;
 		if !empty uniqueId {
 			unset _SESSION[uniqueId . "#" . index];
@@ -212,6 +277,10 @@ abstract class Adapter
 	 */
 	public function getId() -> string
 	{
+		if this->_pending {
+			this->_open();
+		}
+
 		return session_id();
 	}
 
@@ -236,7 +305,7 @@ abstract class Adapter
 	 */
 	public function isStarted() -> boolean
 	{
-		return this->_started;
+		return this->_started || this->_pending;
 	}
 
 	/**
@@ -251,6 +320,10 @@ abstract class Adapter
 	{
 		var uniqueId, key;
 
+		if this->_pending {
+			this->_open();
+		}
+
 		if removeData {
 			let uniqueId = this->_uniqueId;
 			if !empty uniqueId {
@@ -331,6 +404,46 @@ abstract class Adapter
 		return this->remove(index);
 	}
 
+	/**
+	 * Opens a session started in lazy mode
+	 *
+	 * @throws \Phalcon\Session\Exception
+	 */
+	protected function _open() -> void
+	{
+		if this->status() !== self::SESSION_ACTIVE {
+			if headers_sent() {
+				throw new Exception("The session can't be opened because the headers were already sent");
+			}
+			session_start();
+		}
+		let this->_pending = false,
+			this->_started = true;
+	}
+
+	/**
+	 * Remembers the data read from the storage when lazy writes are enabled
+	 */
+	protected function _readData(string sessionId, data) -> void
+	{
+		if this->_lazyWrite {
+			let this->_readId = sessionId,
+				this->_readHash = md5((string) data);
+		}
+	}
+
+	/**
+	 * Checks whether the data to write is the same that was read for the same session
+	 */
+	protected function _isUnchanged(string sessionId, string data) -> boolean
+	{
+		if !this->_lazyWrite || this->_readId !== sessionId {
+			return false;
+		}
+
+		return this->_readHash === md5(data);
+	}
+
 	public function __destruct()
 	{
 		if this->_started {
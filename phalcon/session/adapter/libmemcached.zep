@@ -127,7 +127,12 @@ class Libmemcached extends Adapter implements AdapterInterface
 	 */
 	public function read(string sessionId) -> var
 	{
-		return this->_libmemcached->get(sessionId, this->_lifetime);
+		var data;
+
+		let data = this->_libmemcached->get(sessionId, this->_lifetime);
+		this->_readData(sessionId, data);
+
+		return data;
 	}
 
 	/**
@@ -135,6 +140,16 @@ class Libmemcached extends Adapter implements AdapterInterface
 	 */
 	public function write(string sessionId, string data)
 	{
+		/**
+		 * Unchanged sessions only get their lifetime refreshed
+		 */
+		if this->_isUnchanged(sessionId, data) {
+			if this->_touch && data !== "" {
+				this->_libmemcached->touch(sessionId, this->_lifetime);
+			}
+			return true;
+		}
+
 		this->_libmemcached->save(sessionId, data, this->_lifetime);
 	}
 
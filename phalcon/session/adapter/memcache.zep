@@ -109,7 +109,12 @@ class Memcache extends Adapter implements AdapterInterface
 	 */
 	public function read(string sessionId) -> var
 	{
-		return this->_memcache->get(sessionId, this->_lifetime);
+		var data;
+
+		let data = this->_memcache->get(sessionId, this->_lifetime);
+		this->_readData(sessionId, data);
+
+		return data;
 	}
 
 	/**
@@ -117,6 +122,16 @@ class Memcache extends Adapter implements AdapterInterface
 	 */
 	public function write(string sessionId, string data)
 	{
+		/**
+		 * Unchanged sessions only get their lifetime refreshed
+		 */
+		if this->_isUnchanged(sessionId, data) {
+			if this->_touch && data !== "" {
+				this->_memcache->touch(sessionId, this->_lifetime);
+			}
+			return true;
+		}
+
 		this->_memcache->save(sessionId, data, this->_lifetime);
 	}
 
@@ -39,7 +39,9 @@ use Phalcon\Cache\Frontend\None as FrontendNone;
  *	  'auth'       => 'foobared',
  *    'persistent' => false,
  *    'lifetime'   => 3600,
- *    'prefix'     => 'my_'
+ *    'prefix'     => 'my_',
+ *    'lazyStart'  => true, // Open the session the first time it's used
+ *    'lazyWrite'  => true  // Don't write back unchanged sessions
  * ]);
  *
  * $session->start();
@@ -116,7 +118,12 @@ class Redis extends Adapter implements AdapterInterface
 	 */
 	public function read(sessionId) -> var
 	{
-		return this->_redis->get(sessionId, this->_lifetime);
+		var data;
+
+		let data = this->_redis->get(sessionId, this->_lifetime);
+		this->_readData(sessionId, data);
+
+		return data;
 	}
 
 	/**
@@ -124,6 +131,16 @@ class Redis extends Adapter implements AdapterInterface
 	 */
 	public function write(string sessionId, string data)
 	{
+		/**
+		 * Unchanged sessions only get their lifetime refreshed
+		 */
+		if this->_isUnchanged(sessionId, data) {
+			if this->_touch && data !== "" {
+				this->_redis->touch(sessionId, this->_lifetime);
+			}
+			return true;
+		}
+
 		this->_redis->save(sessionId, data, this->_lifetime);
 	}
 
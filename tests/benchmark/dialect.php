@@ -0,0 +1,67 @@
+<?php
+/**
+ * dialect.php
+ * \Phalcon\Db\Dialect
+ *
+ * Microbenchmark of the SQL generation of Phalcon\Db\Dialect::select(), which
+ * builds the statement with the kernel concatenation functions. Run it with the
+ * extension built before and after a change to ext/kernel/concat.c:
+ *
+ *   php tests/benchmark/dialect.php [iterations] [columns]
+ *
+ * Phalcon Framework
+ *
+ * @copyright (c) 2011-2016 Phalcon Team
+ * @link      http://www.phalconphp.com
+ *
+ * The contents of this file are subject to the New BSD License that is
+ * bundled with this package in the file docs/LICENSE.txt
+ *
+ * If you did not receive a copy of the license and are unable to obtain it
+ * through the world-wide-web, please send an email to license@phalconphp.com
+ * so that we can send you a copy immediately.
+ */
+
+$iterations = isset($argv[1]) ? (int) $argv[1] : 50000;
+$total      = isset($argv[2]) ? (int) $argv[2] : 30;
+
+$columns = array();
+$where   = null;
+
+for ($i = 0; $i < $total; $i++) {
+
+    $columns[] = array('column' . $i, 'r', 'alias' . $i);
+
+    $condition = array(
+        'type'  => 'binary-op',
+        'op'    => '=',
+        'left'  => array('type' => 'qualified', 'domain' => 'r', 'name' => 'column' . $i),
+        'right' => array('type' => 'placeholder', 'value' => ':APR' . $i . ':'),
+    );
+
+    if ($where === null) {
+        $where = $condition;
+    } else {
+        $where = array('type' => 'binary-op', 'op' => 'AND', 'left' => $where, 'right' => $condition);
+    }
+}
+
+$definition = array(
+    'columns' => $columns,
+    'tables'  => array(array('robots', null, 'r')),
+    'where'   => $where,
+    'order'   => array(array(array('type' => 'qualified', 'domain' => 'r', 'name' => 'column0'), 'DESC')),
+    'limit'   => array('number' => array('type' => 'literal', 'value' => 10)),
+);
+
+$dialect = new \Phalcon\Db\Dialect\Mysql();
+$sql     = $dialect->select($definition);
+
+$start = microtime(true);
+for ($i = 0; $i < $iterations; $i++) {
+    $dialect->select($definition);
+}
+$elapsed = microtime(true) - $start;
+
+printf("%d columns, %d bytes of SQL\n", $total, strlen($sql));
+printf("select(): %.2f us/op, %.0f op/s\n", $elapsed * 1e6 / $iterations, $iterations / $elapsed);
@@ -0,0 +1,56 @@
+<?php
+/**
+ * escaper.php
+ * \Phalcon\Escaper
+ *
+ * Microbenchmark of the escapeCss/escapeJs paths. Run it with the extension built
+ * before and after a change to the escaping kernels in ext/kernel/filter.c:
+ *
+ *   php tests/benchmark/escaper.php [iterations]
+ *
+ * "ascii" inputs go through the single byte path, "utf8" inputs are converted to
+ * UTF-32 first (the only path available before the single byte one was added)
+ *
+ * Phalcon Framework
+ *
+ * @copyright (c) 2011-2016 Phalcon Team
+ * @link      http://www.phalconphp.com
+ *
+ * The contents of this file are subject to the New BSD License that is
+ * bundled with this package in the file docs/LICENSE.txt
+ *
+ * If you did not receive a copy of the license and are unable to obtain it
+ * through the world-wide-web, please send an email to license@phalconphp.com
+ * so that we can send you a copy immediately.
+ */
+
+$iterations = isset($argv[1]) ? (int) $argv[1] : 100000;
+
+$inputs = array(
+    'ascii, safe (32B)'      => str_repeat('userName42', 3) . 'ok',
+    'ascii, safe (1KB)'      => str_repeat('abcdefghijklmnopqrstuvwxyz012345', 32),
+    'ascii, mixed (1KB)'     => str_repeat("color: red; width: 10px; // note\n", 31),
+    'utf8, mixed (1KB)'      => str_repeat('émotion { color: red; } ', 40),
+);
+
+$escaper = new \Phalcon\Escaper();
+
+printf("%-24s %12s %12s\n", 'input', 'css ns/op', 'js ns/op');
+
+foreach ($inputs as $name => $input) {
+
+    $times = array();
+
+    foreach (array('escapeCss', 'escapeJs') as $method) {
+
+        $escaper->$method($input);
+
+        $start = microtime(true);
+        for ($i = 0; $i < $iterations; $i++) {
+            $escaper->$method($input);
+        }
+        $times[] = (microtime(true) - $start) * 1e9 / $iterations;
+    }
+
+    printf("%-24s %12.1f %12.1f\n", $name, $times[0], $times[1]);
+}
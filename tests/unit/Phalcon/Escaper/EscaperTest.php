@@ -286,6 +286,47 @@ class EscaperTest extends TBase
         );
     }
 
+    /**
+     * Tests that ASCII strings are escaped like their UTF-32 representation
+     *
+     * @since  2016-06-20
+     */
+    public function testEscapeAscii()
+    {
+        $this->specify(
+            'The escaper does not return safe ASCII strings as they are',
+            function () {
+
+                $escaper = new PhTEscaper();
+
+                $source = str_repeat('abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789', 3);
+
+                expect($escaper->escapeCss($source))->equals($source);
+                expect($escaper->escapeJs($source . ' (a, b);'))->equals($source . ' (a, b);');
+            }
+        );
+
+        $this->specify(
+            'The escaper does not escape ASCII strings like UTF-32 strings',
+            function () {
+
+                $escaper = new PhTEscaper();
+
+                $source   = str_repeat('abcdefghijklmnopqrstuvwxyz0123456789', 2)
+                          . '<a href=\'#\'>"x"</a>&'
+                          . str_repeat('ABCDEFGHIJKLMNOPQRSTUVWXYZ', 2) . '= ';
+                $expected = str_repeat('abcdefghijklmnopqrstuvwxyz0123456789', 2)
+                          . '\3c a\20 href\3d \27 \23 \27 \3e \22 x\22 \3c \2f a\3e \26 '
+                          . str_repeat('ABCDEFGHIJKLMNOPQRSTUVWXYZ', 2) . '\3d \20 ';
+
+                expect($escaper->escapeCss($source))->equals($expected);
+
+                // A non ASCII character is escaped through the UTF-32 path
+                expect($escaper->escapeCss($source . 'é'))->equals($expected . '\e9 ');
+            }
+        );
+    }
+
     /**
      * Tests the escapeUrl
      *
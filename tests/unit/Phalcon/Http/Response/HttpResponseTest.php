@@ -501,4 +501,111 @@ class HttpResponseTest extends Helper\HttpBase
             }
         );
     }
+
+    /**
+     * Tests setFileToSend with byte ranges and conditional requests
+     *
+     * @since  2016-06-24
+     */
+    public function testHttpResponseSetFileToSendRange()
+    {
+        $this->specify(
+            "setFileToSend is not honoring ranges and validators",
+            function () {
+
+                $filename = __FILE__;
+                $expected = file_get_contents($filename);
+
+                $_SERVER['HTTP_RANGE'] = 'bytes=10-19';
+
+                $response = $this->getResponseObject();
+                $response->setFileToSend($filename);
+
+                ob_start();
+                $response->send();
+                $actual = ob_get_clean();
+
+                $headers = $response->getHeaders();
+                expect($actual)->equals(substr($expected, 10, 10));
+                expect($headers->get('Content-Range'))->equals('bytes 10-19/' . strlen($expected));
+                expect($headers->get('Content-Length'))->equals(10);
+
+                $_SERVER['HTTP_RANGE'] = 'bytes=-5';
+
+                $response = $this->getResponseObject();
+                $response->setFileToSend($filename);
+
+                ob_start();
+                $response->send();
+                $actual = ob_get_clean();
+
+                expect($actual)->equals(substr($expected, -5));
+
+                unset($_SERVER['HTTP_RANGE']);
+
+                $_SERVER['HTTP_IF_NONE_MATCH'] = $headers->get('Etag');
+
+                $response = $this->getResponseObject();
+                $response->setFileToSend($filename);
+
+                ob_start();
+                $response->send();
+                $actual = ob_get_clean();
+
+                unset($_SERVER['HTTP_IF_NONE_MATCH']);
+
+                expect($actual)->equals('');
+                expect($response->getHeaders()->get('Status'))->equals('304 Not modified');
+            }
+        );
+    }
+
+    /**
+     * Tests setStream
+     *
+     * @since  2016-06-24
+     */
+    public function testHttpResponseSetStream()
+    {
+        $this->specify(
+            "setStream is not producing the correct results",
+            function () {
+
+                $response = $this->getResponseObject();
+                $response->setStream(new \ArrayIterator(['a', 'b', 'c']), 2);
+
+                $chunks = [];
+                ob_start(function ($buffer) use (&$chunks) {
+                    if ($buffer !== '') {
+                        $chunks[] = $buffer;
+                    }
+                    return '';
+                }, 1);
+                $response->send();
+                ob_end_clean();
+
+                expect($chunks)->equals(['ab', 'c']);
+
+                $response = $this->getResponseObject();
+                $response->setStream(new \ArrayIterator(['a', 'b', 'c']), 2);
+
+                ob_start();
+                $response->send();
+                $actual = ob_get_clean();
+
+                expect($actual)->equals('abc');
+
+                $response = $this->getResponseObject();
+                $response->setStream(function () {
+                    echo 'printed';
+                });
+
+                ob_start();
+                $response->send();
+                $actual = ob_get_clean();
+
+                expect($actual)->equals('printed');
+            }
+        );
+    }
 }
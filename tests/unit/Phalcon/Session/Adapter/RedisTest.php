@@ -110,4 +110,45 @@ class RedisTest extends TBase
             }
         );
     }
+
+    /**
+     * Tests that unchanged sessions aren't written back in lazy write mode
+     *
+     * @since  2016-06-22
+     */
+    public function testLazyWriteSession()
+    {
+        $this->specify(
+            "Unchanged sessions are not written back in lazy write mode",
+            function () {
+                if (!extension_loaded('redis')) {
+                    $this->markTestSkipped('Warning: redis extension is not loaded');
+                    return false;
+                }
+
+                $sessionID = "abcdef123456";
+
+                $options = array(
+                    "host" => "127.0.0.1",
+                    "port" => 6379
+                );
+
+                $session = new PhTRedis($options);
+                $session->write($sessionID, "abc|s:3:\"123\";");
+
+                $lazy = new PhTRedis(array_merge($options, array("lazyWrite" => true)));
+                expect($lazy->read($sessionID))->equals("abc|s:3:\"123\";");
+
+                // Another request stores the session in the meantime
+                $session->write($sessionID, "abc|s:3:\"456\";");
+
+                // The data read didn't change so only its lifetime is refreshed
+                expect($lazy->write($sessionID, "abc|s:3:\"123\";"))->true();
+                expect($session->read($sessionID))->equals("abc|s:3:\"456\";");
+
+                $lazy->write($sessionID, "abc|s:3:\"789\";");
+                expect($session->read($sessionID))->equals("abc|s:3:\"789\";");
+            }
+        );
+    }
 }
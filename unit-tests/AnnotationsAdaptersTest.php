@@ -85,6 +85,54 @@ class AnnotationsAdaptersTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals(get_class($classAnnotations->getClassAnnotations()), 'Phalcon\Annotations\Collection');
 	}
 
+	public function testIndexAdapter()
+	{
+		$indexFile = 'unit-tests/annotations/cache/index.php';
+
+		@unlink($indexFile);
+
+		$adapter = new Phalcon\Annotations\Adapter\Index(array(
+			'indexFile' => $indexFile
+		));
+
+		$classes = $adapter->build('unit-tests/annotations/index/');
+		sort($classes);
+		$this->assertEquals($classes, array('AnnotationsIndexProducts', 'AnnotationsIndexRobots'));
+		$this->assertTrue(file_exists($indexFile));
+
+		// A new adapter reads the annotations from the index without parsing the classes
+		$adapter = new Phalcon\Annotations\Adapter\Index(array(
+			'indexFile' => $indexFile
+		));
+
+		$this->assertEquals(count($adapter->getClasses()), 2);
+
+		$classAnnotations = $adapter->read('AnnotationsIndexProducts');
+		$this->assertEquals(get_class($classAnnotations), 'Phalcon\Annotations\Reflection');
+		$this->assertTrue($classAnnotations->getClassAnnotations()->has('RoutePrefix'));
+		$this->assertEquals(count($classAnnotations->getMethodsAnnotations()), 2);
+
+		$property = $adapter->getProperty('AnnotationsIndexRobots', 'id');
+		$this->assertEquals($property->count(), 1);
+
+		// Classes outside the index are parsed and added to it
+		$classAnnotations = $adapter->get('TestClass');
+		$this->assertEquals(get_class($classAnnotations), 'Phalcon\Annotations\Reflection');
+		$this->assertEquals(count($adapter->getClasses()), 3);
+
+		// Entries of modified files are discarded
+		touch('unit-tests/annotations/index/AnnotationsIndexRobots.php', time() + 10);
+		clearstatcache();
+
+		$adapter = new Phalcon\Annotations\Adapter\Index(array(
+			'indexFile' => $indexFile
+		));
+		$this->assertFalse($adapter->read('AnnotationsIndexRobots'));
+		$this->assertTrue(is_object($adapter->read('AnnotationsIndexProducts')));
+
+		@unlink($indexFile);
+	}
+
 	public function testApcAdapter()
 	{
 		if (!function_exists('apc_fetch')) {
@@ -512,6 +512,64 @@ class AssetsTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($assets->outputJs('js'), '<script type="text/javascript" src="/production/combined-3.js"></script>' . PHP_EOL);
 	}
 
+	public function testBuildManifest()
+	{
+		$manifestFile = 'unit-tests/cache/assets.php';
+
+		@unlink($manifestFile);
+
+		Phalcon\DI::reset();
+
+		$di = new Phalcon\DI();
+
+		$di['url'] = function() {
+			$url = new Phalcon\Mvc\Url();
+			$url->setStaticBaseUri('/');
+			return $url;
+		};
+
+		$assets = new Phalcon\Assets\Manager(array('manifest' => $manifestFile));
+
+		$assets->useImplicitOutput(false);
+
+		$js = $assets->collection('js');
+		$js->setTargetUri('production/combined-4.js');
+		$js->setTargetPath('unit-tests/assets/production/combined-4.js');
+		$js->addJs('unit-tests/assets/jquery.js', true, false);
+		$js->addJs('unit-tests/assets/gs.js');
+		$js->join(true);
+		$js->addFilter(new Phalcon\Assets\Filters\None());
+
+		$content = file_get_contents('unit-tests/assets/jquery.js') . file_get_contents('unit-tests/assets/gs.js') . ';';
+		$hash = substr(md5($content), 0, 12);
+
+		$manifest = $assets->build();
+		$this->assertEquals($manifest, array('production/combined-4.js' => 'production/combined-4.' . $hash . '.js'));
+
+		$targetPath = 'unit-tests/assets/production/combined-4.' . $hash . '.js';
+		$this->assertEquals(file_get_contents($targetPath), $content);
+		if (function_exists('gzdecode')) {
+			$this->assertEquals(gzdecode(file_get_contents($targetPath . '.gz')), $content);
+		}
+
+		// A new manager renders the collection from the manifest even if the sources are missing
+		$assets = new Phalcon\Assets\Manager(array('manifest' => $manifestFile));
+		$assets->useImplicitOutput(false);
+
+		$js = $assets->collection('js');
+		$js->setTargetUri('production/combined-4.js');
+		$js->setTargetPath('unit-tests/assets/production/combined-4.js');
+		$js->addJs('unit-tests/assets/missing.js');
+		$js->join(true);
+		$js->addFilter(new Phalcon\Assets\Filters\None());
+
+		$this->assertEquals($assets->outputJs('js'), '<script type="text/javascript" src="/production/combined-4.' . $hash . '.js"></script>' . PHP_EOL);
+
+		@unlink($targetPath);
+		@unlink($targetPath . '.gz');
+		@unlink($manifestFile);
+	}
+
 	public function testIssue1198()
 	{
 		@unlink(__DIR__ . '/assets/production/1198.css');
@@ -128,4 +128,41 @@ class BeanstalkTest extends PHPUnit_Framework_TestCase
 		$this->assertTrue(is_array($jobStats));
 		$this->assertTrue($jobStats['tube'] === 'beanstalk-test');
 	}
+
+	public function testBatches()
+	{
+		$queue = new Phalcon\Queue\Beanstalk(array('serializer' => 'json'));
+		try {
+			@$queue->connect();
+		}
+		catch (Exception $e) {
+			$this->markTestSkipped($e->getMessage());
+			return;
+		}
+
+		$this->assertEquals($queue->getSerializer(), 'json');
+		$this->assertTrue($queue->choose('beanstalk-batch') !== false);
+		$this->assertTrue($queue->watch('beanstalk-batch') !== false);
+
+		$jobs = array(
+			'a' => array('video' => 1),
+			'b' => array('video' => 2),
+			'c' => array('video' => 3)
+		);
+
+		$ids = $queue->putMany($jobs, array('priority' => 10));
+		$this->assertEquals(array_keys($ids), array('a', 'b', 'c'));
+		foreach ($ids as $id) {
+			$this->assertTrue($id !== false);
+		}
+
+		// Only three jobs are ready, the other reserves return immediately
+		$reserved = $queue->reserveMany(5, 0);
+		$this->assertEquals(count($reserved), 3);
+		$this->assertEquals($reserved[0]->getBody(), array('video' => 1));
+		$this->assertEquals($reserved[2]->getBody(), array('video' => 3));
+
+		$this->assertEquals($queue->deleteMany($reserved), 3);
+		$this->assertEquals($queue->deleteMany(array($ids['a'])), 0);
+	}
 }
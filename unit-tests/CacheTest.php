@@ -219,6 +219,78 @@ class CacheTest extends PHPUnit_Framework_TestCase
 	}
 
 
+	public function testDataFileCacheMultiple()
+	{
+		$frontCache = new Phalcon\Cache\Frontend\Data(array('lifetime' => 10));
+
+		$cache = new Phalcon\Cache\Backend\File($frontCache, array(
+			'cacheDir' => 'unit-tests/cache/',
+		));
+
+		$this->assertTrue($cache->saveMultiple(array('test-multi-1' => array(1, 2), 'test-multi-2' => "nothing interesting")));
+		$this->assertEquals($cache->getMultiple(array('test-multi-1', 'test-multi-2', 'test-multi-3')), array(
+			'test-multi-1' => array(1, 2),
+			'test-multi-2' => "nothing interesting",
+			'test-multi-3' => null
+		));
+
+		//Keys missing in the first backend are read from the next one
+		$memory = new Phalcon\Cache\Backend\Memory($frontCache);
+		$memory->save('test-multi-1', "from memory");
+
+		$multiple = new Phalcon\Cache\Multiple(array($memory, $cache));
+		$this->assertEquals($multiple->getMultiple(array('test-multi-1', 'test-multi-2')), array(
+			'test-multi-1' => "from memory",
+			'test-multi-2' => "nothing interesting"
+		));
+
+		$this->assertTrue($multiple->deleteMultiple(array('test-multi-1', 'test-multi-2')));
+		$this->assertEquals($cache->getMultiple(array('test-multi-1', 'test-multi-2')), array('test-multi-1' => null, 'test-multi-2' => null));
+		$this->assertNull($memory->get('test-multi-1'));
+	}
+
+	public function testDataFileCacheStale()
+	{
+		@unlink('unit-tests/cache/test-stale');
+
+		$frontCache = new Phalcon\Cache\Frontend\Data(array('lifetime' => 10));
+
+		$cache = new Phalcon\Cache\Backend\File($frontCache, array(
+			'cacheDir' => 'unit-tests/cache/',
+			'staleLifetime' => 60
+		));
+
+		//Another worker using the same cache
+		$other = new Phalcon\Cache\Backend\File($frontCache, array(
+			'cacheDir' => 'unit-tests/cache/',
+			'staleLifetime' => 60
+		));
+
+		//The first worker acquires the lock and must compute the content
+		$this->assertNull($cache->getStale('test-stale'));
+		$this->assertNull($other->getStale('test-stale'));
+		$this->assertFalse($other->acquireLock('test-stale'));
+
+		$cache->saveStale('test-stale', 'fresh');
+		$this->assertEquals($cache->getStale('test-stale'), 'fresh');
+		$this->assertEquals($other->getStale('test-stale'), 'fresh');
+
+		//Expired contents are served stale while the lock owner regenerates them
+		$cache->saveStale('test-stale', 'stale', -1);
+		$this->assertNull($cache->getStale('test-stale', 10));
+		$this->assertEquals($other->getStale('test-stale', 10), 'stale');
+
+		$cache->saveStale('test-stale', 'regenerated');
+		$this->assertEquals($other->getStale('test-stale'), 'regenerated');
+
+		$token = $other->acquireLock('test-stale');
+		$this->assertTrue(is_string($token));
+		$this->assertTrue($other->releaseLock('test-stale', $token));
+
+		$this->assertTrue($cache->delete('test-stale'));
+		$this->assertEquals($cache->queryKeys('_PHCL'), array());
+	}
+
 	public function ytestMemoryCache()
 	{
 		$frontCache = new Phalcon\Cache\Frontend\None(array('lifetime' => 10));
@@ -1581,6 +1653,30 @@ class CacheTest extends PHPUnit_Framework_TestCase
 		$this->assertTrue($cache->delete('bcd'));
 	}
 
+	public function testDataRedisCacheMultiple()
+	{
+		$redis = $this->_prepareRedis();
+		if (!$redis) {
+			return false;
+		}
+
+		$frontCache = new Phalcon\Cache\Frontend\Data();
+		$cache = new Phalcon\Cache\Backend\Redis($frontCache, array(
+			'host' => 'localhost',
+			'port' => 6379
+		));
+
+		$this->assertTrue($cache->saveMultiple(array('multi-a' => array(1, 2, 3), 'multi-b' => 2)));
+		$this->assertEquals($cache->getMultiple(array('multi-a', 'multi-b', 'multi-c')), array(
+			'multi-a' => array(1, 2, 3),
+			'multi-b' => 2,
+			'multi-c' => null
+		));
+
+		$this->assertTrue($cache->deleteMultiple(array('multi-a', 'multi-b')));
+		$this->assertEquals($cache->queryKeys('multi-'), array());
+	}
+
 	public function testCacheRedisFlush()
 	{
 		$frontCache = new Phalcon\Cache\Frontend\Data(array('lifetime' => 10));
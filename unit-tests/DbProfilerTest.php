@@ -112,6 +112,33 @@ class DbProfilerTest extends PHPUnit_Framework_TestCase
 		$this->_executeTests($connection);
 	}
 
+	public function testDbStatementCacheStatsSqlite()
+	{
+		require 'unit-tests/config.db.php';
+		if (empty($configSqlite)) {
+			$this->markTestSkipped("Skipped");
+			return;
+		}
+
+		$profiler = new Phalcon\Db\Profiler();
+		$this->assertEquals($profiler->getStatementCacheStats(), array('hits' => 0, 'misses' => 0, 'evictions' => 0, 'size' => 0));
+
+		$connection = new Phalcon\Db\Adapter\Pdo\Sqlite(array_merge($configSqlite, array('statementCacheSize' => 2)));
+		$profiler->setConnection($connection);
+		$this->assertSame($profiler->getConnection(), $connection);
+
+		for ($i = 1; $i <= 3; $i++) {
+			$result = $connection->query("SELECT * FROM personas WHERE cupo > ? LIMIT 1", array($i));
+			unset($result);
+		}
+
+		// The statistics are read from the connection when requested
+		$this->assertEquals($profiler->getStatementCacheStats(), array('hits' => 2, 'misses' => 1, 'evictions' => 0, 'size' => 1));
+
+		$connection->connect();
+		$this->assertEquals($profiler->getStatementCacheStats(), array('hits' => 0, 'misses' => 0, 'evictions' => 0, 'size' => 0));
+	}
+
 	public function _executeTests($connection)
 	{
 
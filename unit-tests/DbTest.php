@@ -108,6 +108,84 @@ class DbTest extends PHPUnit_Framework_TestCase
 		}
 	}
 
+	public function testDbStatementCacheSqlite()
+	{
+		require 'unit-tests/config.db.php';
+		if (empty($configSqlite)) {
+			$this->markTestSkipped("Skipped");
+			return;
+		}
+
+		$connection = new Phalcon\Db\Adapter\Pdo\Sqlite(array_merge($configSqlite, array('statementCacheSize' => 2)));
+		$this->assertEquals($connection->getStatementCacheSize(), 2);
+
+		for ($i = 1; $i <= 3; $i++) {
+			$result = $connection->query("SELECT * FROM personas WHERE cupo > ? LIMIT 1", array($i));
+			$this->assertEquals(count($result->fetch()), 22);
+			unset($result);
+		}
+		$this->assertEquals($connection->getStatementCacheStats(), array('hits' => 2, 'misses' => 1, 'evictions' => 0, 'size' => 1));
+
+		// A statement used by a live result is never shared
+		$first = $connection->query("SELECT * FROM personas WHERE cupo > ? LIMIT 2", array(0));
+		$second = $connection->query("SELECT * FROM personas WHERE cupo > ? LIMIT 2", array(0));
+		$this->assertNotSame($first->getInternalResult(), $second->getInternalResult());
+		$this->assertEquals(count($first->fetchAll()), 2);
+		$this->assertEquals(count($second->fetchAll()), 2);
+		unset($first, $second);
+
+		$connection->execute("UPDATE personas SET cupo = cupo WHERE cupo < ?", array(0));
+		$this->assertEquals($connection->getStatementCacheStats(), array('hits' => 2, 'misses' => 4, 'evictions' => 1, 'size' => 2));
+
+		$connection->connect();
+		$this->assertEquals($connection->getStatementCacheStats(), array('hits' => 0, 'misses' => 0, 'evictions' => 0, 'size' => 0));
+	}
+
+	public function testDbInsertMultipleSqlite()
+	{
+		require 'unit-tests/config.db.php';
+		if (empty($configSqlite)) {
+			$this->markTestSkipped("Skipped");
+			return;
+		}
+
+		$connection = new Phalcon\Db\Adapter\Pdo\Sqlite($configSqlite);
+		$connection->delete("prueba");
+
+		$success = $connection->insertMultiple('prueba', array(
+			array("LOL multi 1", "A"),
+			array("LOL multi 2", null),
+			array(new Phalcon\Db\RawValue("'LOL multi 3'"), "A")
+		), array('nombre', 'estado'));
+		$this->assertTrue($success);
+		$this->assertEquals($connection->getSQLStatement(), 'INSERT INTO "prueba" ("nombre", "estado") VALUES (?, ?), (?, null), (\'LOL multi 3\', ?)');
+		$this->assertEquals($connection->getSQLVariables(), array("LOL multi 1", "A", "LOL multi 2", "A"));
+
+		// Rows are chunked by the dialect limits
+		$rows = array();
+		for ($i = 0; $i < 1200; $i++) {
+			$rows[] = array("LOL chunk " . $i, "C");
+		}
+		$this->assertTrue($connection->insertMultiple('prueba', $rows, array('nombre', 'estado')));
+		$row = $connection->fetchOne("SELECT COUNT(*) AS cnt FROM prueba WHERE estado = 'C'");
+		$this->assertEquals($row['cnt'], 1200);
+
+		$batch = $connection->createBatch('prueba', array('nombre', 'estado'), null, 10);
+		for ($i = 0; $i < 25; $i++) {
+			$batch->add(array("LOL batch " . $i, "B"));
+		}
+		$this->assertEquals(count($batch), 5);
+		$this->assertEquals($batch->flush(), 5);
+		$this->assertEquals($batch->getInsertedRows(), 25);
+		$row = $connection->fetchOne("SELECT COUNT(*) AS cnt FROM prueba WHERE estado = 'B'");
+		$this->assertEquals($row['cnt'], 25);
+
+		$connection->delete("prueba");
+
+		$dialect = new Phalcon\Db\Dialect\Oracle();
+		$this->assertEquals($dialect->insertMultiple('ROBOTS', array('NAME', 'YEAR'), array(array('?', '?'), array('?', 'null'))), 'INSERT ALL INTO ROBOTS (NAME, YEAR) VALUES (?, ?) INTO ROBOTS (NAME, YEAR) VALUES (?, null) SELECT 1 FROM DUAL');
+	}
+
 	protected function _executeTests($connection)
 	{
 
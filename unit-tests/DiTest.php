@@ -407,4 +407,95 @@ class DiTest extends PHPUnit_Framework_TestCase
 		$this->assertTrue($di->getService('resolved')->isResolved());
 		$this->assertFalse($di->getService('notresolved')->isResolved());
 	}
+
+	public function testCompile()
+	{
+		$response = new Phalcon\Http\Response();
+		$this->_di->set('response', $response);
+		$this->_di->set('simple', 'InjectableComponent');
+		$this->_di->set('closure', function($value = null) { return new SomeComponent($value); });
+		$this->_di->set('missing', 'UnknownComponent');
+		$this->_di->set('shared', 'SimpleComponent', true);
+
+		$this->_di->set('complex',
+			array(
+				'className' => 'InjectableComponent',
+				'arguments' => array(
+					array('type' => 'service', 'name' => 'response')
+				),
+				'calls' => array(
+					array('method' => 'setResponse', 'arguments' => array(
+						array('type' => 'parameter', 'value' => 'response')
+					))
+				),
+				'properties' => array(
+					array('name' => 'other', 'value' => array('type' => 'instance', 'className' => 'SomeComponent', 'arguments' => array(1)))
+				)
+			)
+		);
+
+		$this->_di->set('invalid', array('className' => 'InjectableComponent', 'arguments' => array(array('value' => 1))));
+
+		$this->_di->compile();
+
+		$this->assertTrue($this->_di->isCompiled('simple'));
+		$this->assertTrue($this->_di->isCompiled('closure'));
+		$this->assertTrue($this->_di->isCompiled('complex'));
+		$this->assertFalse($this->_di->isCompiled('missing'));
+		$this->assertFalse($this->_di->isCompiled('invalid'));
+		$this->assertFalse($this->_di->isCompiled('shared'));
+
+		$this->assertInstanceOf('InjectableComponent', $this->_di->get('simple'));
+		$this->assertEquals($this->_di->get('simple', array('response'))->getResponse(), 'response');
+		$this->assertEquals($this->_di->get('closure', array(10))->someProperty, 10);
+
+		$component = $this->_di->get('complex');
+		$this->assertEquals($component->getResponse(), 'response');
+		$this->assertEquals($component->other->someProperty, 1);
+		$this->assertNotSame($component, $this->_di->get('complex'));
+
+		try {
+			$this->_di->get('invalid');
+			$this->assertTrue(false);
+		} catch (Phalcon\Di\Exception $e) {
+			$this->assertEquals($e->getMessage(), 'Argument at position 0 must have a type');
+		}
+
+		// Changing a service drops its compiled factory
+		$this->_di->set('simple', 'SimpleComponent');
+		$this->assertFalse($this->_di->isCompiled('simple'));
+		$this->assertInstanceOf('SimpleComponent', $this->_di->get('simple'));
+
+		$this->_di->getService('closure');
+		$this->assertFalse($this->_di->isCompiled('closure'));
+	}
+
+	public function testCompileNonArrayArguments()
+	{
+		$this->_di->set('simple', 'InjectableComponent');
+		$this->_di->set('scalarArguments', array('className' => 'InjectableComponent', 'arguments' => 'x'));
+		$this->_di->set('scalarArgument', array('className' => 'InjectableComponent', 'arguments' => array(1)));
+		$this->_di->set('scalarProperty', array(
+			'className' => 'InjectableComponent',
+			'properties' => array(
+				array('name' => 'other', 'value' => 'x')
+			)
+		));
+
+		// A malformed definition doesn't stop the other services from being compiled
+		$this->_di->compile();
+
+		$this->assertTrue($this->_di->isCompiled('simple'));
+		$this->assertFalse($this->_di->isCompiled('scalarArguments'));
+		$this->assertFalse($this->_di->isCompiled('scalarArgument'));
+		$this->assertFalse($this->_di->isCompiled('scalarProperty'));
+
+		$builder = new Phalcon\Di\Service\Builder();
+		try {
+			$builder->compile(array('className' => 'InjectableComponent', 'arguments' => array(1)));
+			$this->assertTrue(false);
+		} catch (Phalcon\Di\Exception $e) {
+			$this->assertEquals($e->getMessage(), 'Argument at position 0 must be an array');
+		}
+	}
 }
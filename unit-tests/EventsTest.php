@@ -251,6 +251,39 @@ class EventsTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals($number, 1);
 	}
 
+	public function testEventsStatistics()
+	{
+		$eventsManager = new Phalcon\Events\Manager();
+		$eventsManager->enablePriorities(true);
+		$eventsManager->enableStatistics(true);
+
+		$order = array();
+		$eventsManager->attach('some-type', function() use (&$order) { $order[] = 'low'; }, 50);
+		$eventsManager->attach('some-type', function() use (&$order) { $order[] = 'high'; }, 150);
+		$eventsManager->attach('some-type:beforeSome', function() use (&$order) { $order[] = 'event'; });
+
+		$eventsManager->fire('some-type:beforeSome', $this);
+		$eventsManager->fire('some-type:beforeSome', $this);
+		$eventsManager->fire('other-type:beforeOther', $this);
+
+		$this->assertEquals($order, array('high', 'low', 'event', 'high', 'low', 'event'));
+
+		$statistics = $eventsManager->getStatistics();
+		$this->assertEquals($statistics['some-type:beforeSome']['fired'], 2);
+		$this->assertEquals($statistics['some-type:beforeSome']['listeners'], 6);
+		$this->assertEquals($statistics['other-type:beforeOther']['fired'], 1);
+		$this->assertEquals($statistics['other-type:beforeOther']['listeners'], 0);
+
+		//Listeners attached after firing are notified
+		$eventsManager->attach('some-type', function() use (&$order) { $order[] = 'highest'; }, 200);
+		$order = array();
+		$eventsManager->fire('some-type:beforeSome', $this);
+		$this->assertEquals($order, array('highest', 'high', 'low', 'event'));
+
+		$eventsManager->enableStatistics(false);
+		$this->assertEquals($eventsManager->getStatistics(), array());
+	}
+
 	public function testEventsWeakref()
 	{
 		if (!class_exists('WeakRef')) {
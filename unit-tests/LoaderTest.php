@@ -203,6 +203,50 @@ class LoaderTest extends PHPUnit_Framework_TestCase
 		$loader->unregister();
 	}
 
+	public function testClassMapAuthoritative()
+	{
+		@unlink('unit-tests/cache/classmap.php');
+
+		$loader = new Phalcon\Loader();
+
+		$loader->registerNamespaces(array(
+			"Example\\Engines" => "unit-tests/vendor/example/Engines/"
+		));
+
+		$loader->registerDirs(array(
+			"unit-tests/vendor/example/dialects/"
+		));
+
+		$classMap = $loader->dumpClassMap('unit-tests/cache/classmap.php');
+		$this->assertEquals($classMap, array(
+			'Example\Engines\LeEngine' => 'unit-tests/vendor/example/Engines/LeEngine.php',
+			'LeDialect' => 'unit-tests/vendor/example/dialects/LeDialect.php'
+		));
+		$this->assertEquals(require 'unit-tests/cache/classmap.php', $classMap);
+
+		$loader->register();
+
+		//Unknown classes are searched in the filesystem and remembered in the lookup cache
+		$loader->setLookupCache(new Phalcon\Cache\Backend\Memory(new Phalcon\Cache\Frontend\Data()));
+
+		$this->assertFalse(class_exists('Example\Engines\LeMissingEngine'));
+		$this->assertEquals($loader->getStatistics(), array('lookups' => 1, 'stats' => 2, 'hits' => 0, 'cacheHits' => 0));
+
+		$this->assertFalse(class_exists('Example\Engines\LeMissingEngine'));
+		$this->assertEquals($loader->getStatistics(), array('lookups' => 2, 'stats' => 2, 'hits' => 0, 'cacheHits' => 1));
+
+		//Authoritative mode never touches the filesystem
+		$loader->registerClasses($classMap)->setAuthoritative(true);
+		$this->assertTrue($loader->isAuthoritative());
+
+		$this->assertFalse(class_exists('Example\Engines\LeOtherMissingEngine'));
+		$this->assertEquals($loader->getStatistics(), array('lookups' => 3, 'stats' => 2, 'hits' => 0, 'cacheHits' => 1));
+
+		$loader->unregister();
+
+		@unlink('unit-tests/cache/classmap.php');
+	}
+
 	public function testEvents()
 	{
 
@@ -157,4 +157,39 @@ class LoggerTest extends PHPUnit_Framework_TestCase
 			$this->assertEquals($line['message'], $loggerMessage[$key]);
 		}
 	}
+
+	public function testFileAdapterBuffered()
+	{
+		date_default_timezone_set('UTC');
+
+		$logfile = "unit-tests/logs/file.log";
+
+		@unlink($logfile);
+
+		$logger = new \Phalcon\Logger\Adapter\File($logfile, array(
+			'buffer'      => true,
+			'bufferLines' => 3,
+			'flushLevel'  => \Phalcon\Logger::ERROR
+		));
+		$this->assertTrue($logger->isBuffered());
+
+		$logger->debug("First message");
+		$logger->info("Second message");
+		clearstatcache();
+		$this->assertEquals(filesize($logfile), 0);
+
+		// The line limit is reached
+		$logger->info("Third message");
+		$this->assertEquals(count(file($logfile)), 3);
+
+		// Errors are written immediately
+		$logger->debug("Fourth message");
+		$logger->error("An error");
+		$this->assertEquals(count(file($logfile)), 5);
+
+		$logger->debug("Last message");
+		$this->assertEquals(count(file($logfile)), 5);
+		$logger->close();
+		$this->assertEquals(count(file($logfile)), 6);
+	}
 }
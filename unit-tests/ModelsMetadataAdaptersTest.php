@@ -314,6 +314,105 @@ class ModelsMetadataAdaptersTest extends PHPUnit_Framework_TestCase
 		Robots::findFirst();
 	}
 
+	public function testMetadataShared()
+	{
+		require __DIR__ . '/config.db.php';
+		if (empty($configMysql)) {
+			$this->markTestSkipped('Test skipped');
+			return;
+		}
+
+		@unlink(__DIR__ . '/cache/metadata.php');
+
+		$di = $this->_getDI();
+
+		$di->set('modelsMetadata', function(){
+			return new Phalcon\Mvc\Model\Metadata\Shared(array(
+				'metaDataFile' => __DIR__ . '/cache/metadata.php',
+				'schemaVersion' => '1'
+			));
+		});
+
+		$metaData = $di->getShared('modelsMetadata');
+
+		$this->assertTrue($metaData->isEmpty());
+
+		Robots::findFirst();
+
+		$store = require __DIR__ . '/cache/metadata.php';
+		$this->assertEquals($store['version'], '1');
+		$this->assertEquals($store['meta']['robots-robots'], $this->_data['meta-robots-robots']);
+		$this->assertEquals($store['map']['robots'], $this->_data['map-robots']);
+
+		//The whole store is loaded by new instances
+		$metaData = new Phalcon\Mvc\Model\Metadata\Shared(array(
+			'metaDataFile' => __DIR__ . '/cache/metadata.php',
+			'schemaVersion' => '1'
+		));
+		$this->assertFalse($metaData->isEmpty());
+		$this->assertEquals($metaData->read('meta-robots-robots'), $this->_data['meta-robots-robots']);
+
+		//A new schema version discards the store
+		$metaData = new Phalcon\Mvc\Model\Metadata\Shared(array(
+			'metaDataFile' => __DIR__ . '/cache/metadata.php',
+			'schemaVersion' => '2'
+		));
+		$this->assertTrue($metaData->isEmpty());
+		$this->assertNull($metaData->read('meta-robots-robots'));
+
+		//Warm up the models in a directory
+		@mkdir(__DIR__ . '/cache/warmup');
+		copy(__DIR__ . '/models/Robots.php', __DIR__ . '/cache/warmup/Robots.php');
+
+		$metaData->setDI($di);
+		$this->assertEquals($metaData->warmUp(__DIR__ . '/cache/warmup/'), array('Robots'));
+
+		$store = require __DIR__ . '/cache/metadata.php';
+		$this->assertEquals($store['version'], '2');
+		$this->assertEquals($store['meta']['robots-robots'], $this->_data['meta-robots-robots']);
+
+		unlink(__DIR__ . '/cache/warmup/Robots.php');
+		rmdir(__DIR__ . '/cache/warmup');
+		@unlink(__DIR__ . '/cache/metadata.php');
+		@unlink(__DIR__ . '/cache/metadata.php.lock');
+	}
+
+	public function testMetadataSharedConcurrentWrites()
+	{
+		@unlink(__DIR__ . '/cache/metadata.php');
+
+		$options = array(
+			'metaDataFile' => __DIR__ . '/cache/metadata.php',
+			'schemaVersion' => '1'
+		);
+
+		//Two workers loading the store before any of them writes to it
+		$first = new Phalcon\Mvc\Model\Metadata\Shared($options);
+		$second = new Phalcon\Mvc\Model\Metadata\Shared($options);
+
+		$first->write('meta-robots-robots', $this->_data['meta-robots-robots']);
+		$second->write('map-robots', $this->_data['map-robots']);
+
+		$store = require __DIR__ . '/cache/metadata.php';
+		$this->assertEquals($store['meta']['robots-robots'], $this->_data['meta-robots-robots']);
+		$this->assertEquals($store['map']['robots'], $this->_data['map-robots']);
+		$this->assertEquals($second->read('meta-robots-robots'), $this->_data['meta-robots-robots']);
+
+		//Entries of another schema version aren't merged
+		$metaData = new Phalcon\Mvc\Model\Metadata\Shared(array(
+			'metaDataFile' => __DIR__ . '/cache/metadata.php',
+			'schemaVersion' => '2'
+		));
+		$metaData->write('map-robots', $this->_data['map-robots']);
+
+		$store = require __DIR__ . '/cache/metadata.php';
+		$this->assertEquals($store['version'], '2');
+		$this->assertFalse(isset($store['meta']['robots-robots']));
+
+		@unlink(__DIR__ . '/cache/metadata.php');
+		@unlink(__DIR__ . '/cache/metadata.php.lock');
+	}
+
 	public function testMetadataMemcache()
 	{
 		require __DIR__ . '/config.db.php';
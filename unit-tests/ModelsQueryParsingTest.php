@@ -65,6 +65,45 @@ class ModelsQueryParsingTest extends PHPUnit_Framework_TestCase
 		return $di;
 	}
 
+	public function testPersistentCache()
+	{
+		require 'unit-tests/config.db.php';
+		if (empty($configMysql)) {
+			$this->markTestSkipped('Test skipped');
+			return;
+		}
+
+		$di = $this->_getDI();
+
+		$cache = new Phalcon\Cache\Backend\Memory(new Phalcon\Cache\Frontend\Data());
+		Query::setPersistentCache($cache, '1');
+
+		$query = new Query('SELECT * FROM Robots WHERE id > 10');
+		$query->setDI($di);
+		$expected = $query->parse();
+
+		$this->assertEquals(Query::getPersistentCacheStats(), array('hits' => 0, 'misses' => 1));
+		$this->assertEquals(count($cache->queryKeys('phql-')), 1);
+
+		$query = new Query('SELECT * FROM Robots WHERE id > 10');
+		$query->setDI($di);
+		$this->assertEquals($query->parse(), $expected);
+		$this->assertEquals($query->getType(), Query::TYPE_SELECT);
+
+		$this->assertEquals(Query::getPersistentCacheStats(), array('hits' => 1, 'misses' => 1));
+
+		// The old entry is left to expire, the new version stores its own
+		Query::invalidatePersistentCache('2');
+
+		$query = new Query('SELECT * FROM Robots WHERE id > 10');
+		$query->setDI($di);
+		$this->assertEquals($query->parse(), $expected);
+		$this->assertEquals(Query::getPersistentCacheStats(), array('hits' => 1, 'misses' => 2));
+		$this->assertEquals(count($cache->queryKeys('phql-')), 2);
+
+		Query::setPersistentCache(null);
+	}
+
 	/**
 	 * @medium
 	 */
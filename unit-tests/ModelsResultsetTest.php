@@ -18,6 +18,16 @@
   +------------------------------------------------------------------------+
 */
 
+class HydrationPlanRecord
+{
+	public $dirtyState;
+
+	public function setDirtyState($dirtyState)
+	{
+		$this->dirtyState = $dirtyState;
+	}
+}
+
 class ModelsResultsetTest extends PHPUnit_Framework_TestCase
 {
 
@@ -660,4 +670,111 @@ class ModelsResultsetTest extends PHPUnit_Framework_TestCase
 		$this->assertEquals(get_class($personas[23]), 'Personas');
 		$this->assertEquals(get_class($personas[23]), 'Personas');
 	}
-}
\ No newline at end of file
+
+	public function testStreamingResultset()
+	{
+		if (!$this->_prepareTestSqlite()) {
+			$this->markTestSkipped("Skipped");
+			return;
+		}
+
+		$personas = Personas::find(array(
+			'limit' => 33
+		));
+		$personas->setStreaming(true);
+		$this->assertTrue($personas->isStreaming());
+
+		$number = 0;
+		$previous = null;
+		foreach ($personas as $persona) {
+			$this->assertEquals(get_class($persona), 'Personas');
+			if ($previous !== null) {
+				$this->assertSame($persona, $previous);
+			}
+			$previous = $persona;
+			$number++;
+		}
+		$this->assertEquals($number, 33);
+
+		try {
+			$personas->rewind();
+			$this->assertFalse(true);
+		} catch (Exception $e) {
+			$this->assertEquals($e->getMessage(), 'Streaming resultsets can only be traversed forward');
+		}
+
+		$personas = Personas::find(array(
+			'limit' => 33
+		));
+		$personas->setStreaming(true);
+
+		$sizes = array();
+		while ($batch = $personas->fetchBatch(10)) {
+			$sizes[] = count($batch);
+			$this->assertNotSame($batch[0], $batch[1]);
+		}
+		$this->assertEquals($sizes, array(10, 10, 10, 3));
+	}
+
+	public function testLazyCountResultset()
+	{
+		if (!$this->_prepareTestSqlite()) {
+			$this->markTestSkipped("Skipped");
+			return;
+		}
+
+		Phalcon\Mvc\Model::setup(array('lazyCount' => true));
+
+		$personas = Personas::find(array(
+			'limit' => 33
+		));
+
+		$number = 0;
+		foreach ($personas as $key => $persona) {
+			$this->assertEquals($key, $number);
+			$this->assertEquals(get_class($persona), 'Personas');
+			$number++;
+		}
+		$this->assertEquals($number, 33);
+		$this->assertEquals(count($personas), 33);
+
+		$robot = Robots::findFirst(array('order' => 'id'));
+		$this->assertEquals(get_class($robot), 'Robots');
+
+		$robots = Robots::find(array('id < 0'));
+		$this->assertFalse($robots->valid());
+		$this->assertFalse($robots->getFirst());
+		$this->assertEquals(count($robots), 0);
+
+		Phalcon\Mvc\Model::setup(array('lazyCount' => false));
+	}
+
+	public function testHydrationPlan()
+	{
+		$columnMap = array(
+			'id' => array('code', Phalcon\Db\Column::TYPE_INTEGER),
+			'name' => array('theName', Phalcon\Db\Column::TYPE_VARCHAR),
+			'price' => array('thePrice', Phalcon\Db\Column::TYPE_DECIMAL),
+			'active' => array('isActive', Phalcon\Db\Column::TYPE_BOOLEAN)
+		);
+
+		$row = array('id' => '10', 'name' => 'Astro Boy', 'price' => '', 'active' => '1');
+
+		$plan = Phalcon\Mvc\Model::getHydrationPlan($row, $columnMap);
+		$this->assertEquals($plan, array(
+			array('code', Phalcon\Mvc\Model::HYDRATE_CAST_INTEGER),
+			array('theName', Phalcon\Mvc\Model::HYDRATE_CAST_NONE),
+			array('thePrice', Phalcon\Mvc\Model::HYDRATE_CAST_DOUBLE),
+			array('isActive', Phalcon\Mvc\Model::HYDRATE_CAST_BOOLEAN)
+		));
+
+		$object = Phalcon\Mvc\Model::assignHydrationPlan(new HydrationPlanRecord(), $row, $plan, $columnMap);
+		$this->assertSame($object->dirtyState, 0);
+		$this->assertSame($object->code, 10);
+		$this->assertSame($object->theName, 'Astro Boy');
+		$this->assertNull($object->thePrice);
+		$this->assertTrue($object->isActive);
+
+		$this->assertEquals(Phalcon\Mvc\Model::getHydrationPlan(array('id' => 1, 0 => 1), null), array(array('id', Phalcon\Mvc\Model::HYDRATE_CAST_NONE), null));
+	}
+}
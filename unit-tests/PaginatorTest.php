@@ -560,4 +560,66 @@ class PaginatorTest extends PHPUnit_Framework_TestCase
 		$this->assertInternalType('int', $page->total_items);
 		$this->assertInternalType('int', $page->total_pages);
 	}
+
+	public function testKeysetPaginator()
+	{
+		require 'unit-tests/config.db.php';
+		if (empty($configMysql)) {
+			$this->markTestSkipped('Test skipped');
+			return;
+		}
+
+		$di = $this->_loadDI();
+
+		$builder = $di['modelsManager']->createBuilder()
+					->columns('cedula, nombres')
+					->from('Personnes');
+
+		$paginator = new Phalcon\Paginator\Adapter\Keyset(array(
+			"builder" => $builder,
+			"columns" => array("cedula" => "ASC"),
+			"limit"   => 10,
+			"count"   => true
+		));
+
+		$first = $paginator->getPaginate();
+
+		$this->assertEquals(count($first->items), 10);
+		$this->assertNull($first->before);
+		$this->assertNotNull($first->next);
+		$this->assertEquals($first->total_items, 2180);
+
+		// The second page is the same one obtained with an offset
+		$offsetBuilder = $di['modelsManager']->createBuilder()
+					->columns('cedula, nombres')
+					->from('Personnes')
+					->orderBy('cedula')
+					->limit(10, 10);
+
+		$expected = array();
+		foreach ($offsetBuilder->getQuery()->execute() as $row) {
+			$expected[] = $row->cedula;
+		}
+
+		$paginator->setCursor($first->next);
+		$second = $paginator->getPaginate();
+
+		$actual = array();
+		foreach ($second->items as $row) {
+			$actual[] = $row->cedula;
+		}
+
+		$this->assertEquals($actual, $expected);
+		$this->assertNotNull($second->before);
+		$this->assertNotNull($second->next);
+
+		// Going back returns the first page in the same order
+		$paginator->setCursor($second->before);
+		$page = $paginator->getPaginate();
+
+		$this->assertEquals(count($page->items), 10);
+		$this->assertEquals($page->items[0]->cedula, $first->items[0]->cedula);
+		$this->assertEquals($page->items[9]->cedula, $first->items[9]->cedula);
+		$this->assertNull($page->before);
+	}
 }
@@ -243,4 +243,69 @@ class RouterMvcAnnotationsTest extends PHPUnit_Framework_TestCase
 			$this->assertEquals($router->isExactControllerName(), true);
 		}
 	}
+
+	public function testRouterExportRoutes()
+	{
+		$router = new Phalcon\Mvc\Router\Annotations(false);
+		$router->setDI($this->_getDI());
+		$router->addResource('Robots', '/');
+		$router->addResource('Products', '/products');
+		$router->addResource('About', '/about');
+		$router->addResource('Main', '/');
+		$router->loadResources();
+		$this->assertEquals(count($router->getRoutes()), 9);
+
+		$routesFile = 'unit-tests/cache/routes.php';
+		file_put_contents($routesFile, '<?php return ' . var_export($router->exportRoutes(), true) . ';');
+
+		$router = new Phalcon\Mvc\Router\Annotations(false);
+		$router->setDI($this->_getDI());
+		$router->addResource('Robots', '/');
+		$router->importRoutes(require $routesFile);
+		@unlink($routesFile);
+
+		$route = $router->getRouteByName('save-robot');
+		$this->assertEquals(get_class($route), 'Phalcon\Mvc\Router\Route');
+		$this->assertEquals($route->getHttpMethods(), 'PUT');
+
+		// The resources are not read again
+		$_SERVER['REQUEST_METHOD'] = 'GET';
+		$router->handle('/products/edit/100');
+		$this->assertEquals(count($router->getRoutes()), 9);
+		$this->assertEquals($router->getControllerName(), 'products');
+		$this->assertEquals($router->getActionName(), 'edit');
+		$this->assertEquals($router->getParams(), array('id' => '100'));
+
+		$_SERVER['REQUEST_METHOD'] = 'POST';
+		$router->handle('/about/team');
+		$this->assertEquals($router->getControllerName(), 'about');
+		$this->assertEquals($router->getActionName(), 'teampost');
+	}
+
+	public function testRouterExportRoutesWithClosures()
+	{
+		$router = new Phalcon\Mvc\Router(false);
+		$router->add('/robots/{id}')->convert('id', function ($id) {
+			return (int) $id;
+		});
+
+		try {
+			$router->exportRoutes();
+			$this->assertTrue(false);
+		} catch (Phalcon\Mvc\Router\Exception $e) {
+			$this->assertEquals($e->getMessage(), "The converter 'id' of the route '/robots/{id}' cannot be exported");
+		}
+
+		$router = new Phalcon\Mvc\Router(false);
+		$router->add('/robots')->beforeMatch(function () {
+			return true;
+		});
+
+		try {
+			$router->exportRoutes();
+			$this->assertTrue(false);
+		} catch (Phalcon\Mvc\Router\Exception $e) {
+			$this->assertEquals($e->getMessage(), "Routes with a Before-Match closure cannot be exported ('/robots')");
+		}
+	}
 }
@@ -205,6 +205,74 @@ class RouterMvcTest extends PHPUnit_Framework_TestCase
 
 	}
 
+	public function testCompiledRoutes()
+	{
+		Phalcon\Mvc\Router\Route::reset();
+
+		$uris = array(
+			'/',
+			'/documentation/index/hello',
+			'/api/users',
+			'/api/users/',
+			'/api/users/100',
+			'/api/users/100/edit',
+			'/api/users/abc',
+			'/api/posts/10',
+			'/api/posts/10/comments/4',
+			'/es/news',
+			'/manual/en/translate.adapter.html',
+			'/manual/en/',
+			'/static/route',
+			'/nothing/here/at/all',
+			'posts',
+		);
+
+		$routers = array();
+		foreach (array(false, true) as $compiled) {
+
+			$router = new Phalcon\Mvc\Router();
+			$router->useCompiledRoutes($compiled);
+
+			$router->add('/', 'Index::index');
+			$router->add('/api/users', 'Users::list');
+			$router->add('/api/users/{id:[0-9]+}', 'Users::show');
+			$router->add('/api/users/{id:[0-9]+}/edit', 'Users::edit');
+			$router->add('/api/users/{name}', 'Users::byName');
+			$router->add('/api/:controller/:int', array('controller' => 1, 'action' => 'show', 'id' => 2));
+			$router->add('/api/posts/{post:[0-9]+}/comments/{comment:[0-9]+}', 'Comments::show');
+			$router->add('/([a-z]{2})/:controller', array('controller' => 2, 'action' => 'index', 'language' => 1));
+			$router->add('/manual/([a-z]{2})/([a-z\.]+)\.html', array('controller' => 'manual', 'action' => 'show', 'language' => 1, 'file' => 2));
+			$router->add('#^/manual/([a-z]{2})/?$#i', array('controller' => 'manual', 'action' => 'index', 'language' => 1));
+			$router->add('/static/route', 'Static::route');
+			$router->add('/static/route', 'Static::overridden');
+
+			$routers[] = $router;
+		}
+
+		foreach ($uris as $uri) {
+
+			$routers[0]->handle($uri);
+			$routers[1]->handle($uri);
+
+			$this->assertEquals($routers[0]->wasMatched(), $routers[1]->wasMatched(), "Testing " . $uri);
+			$this->assertEquals($routers[0]->getControllerName(), $routers[1]->getControllerName(), "Testing " . $uri);
+			$this->assertEquals($routers[0]->getActionName(), $routers[1]->getActionName(), "Testing " . $uri);
+			$this->assertEquals($routers[0]->getParams(), $routers[1]->getParams(), "Testing " . $uri);
+			$this->assertEquals($routers[0]->getMatchedRoute(), $routers[1]->getMatchedRoute(), "Testing " . $uri);
+		}
+
+		$routers[1]->handle('/api/users/100/edit');
+		$this->assertEquals($routers[1]->getActionName(), 'edit');
+		$this->assertEquals($routers[1]->getParams(), array('id' => '100'));
+
+		$routers[1]->handle('/static/route');
+		$this->assertEquals($routers[1]->getActionName(), 'overridden');
+
+		$routers[1]->add('/api/users/me', 'Users::me');
+		$routers[1]->handle('/api/users/me');
+		$this->assertEquals($routers[1]->getActionName(), 'me');
+	}
+
 	public function _testRouterHttp()
 	{
 
@@ -366,6 +434,56 @@ class RouterMvcTest extends PHPUnit_Framework_TestCase
 
 	}
 
+	public function testNamedRoutesIndex()
+	{
+
+		Phalcon\Mvc\Router\Route::reset();
+
+		$router = new Phalcon\Mvc\Router(false);
+
+		$first = $router->add('/first')->setName('first');
+		$this->assertEquals($first, $router->getRouteByName('first'));
+
+		// Routes named after the index was built are found
+		$second = $router->add('/second');
+		$second->setName('second');
+		$this->assertEquals($second, $router->getRouteByName('second'));
+		$this->assertEquals($second, $router->getRouteById(1));
+
+		// Renamed routes aren't found by their old name
+		$first->setName('renamed');
+		$this->assertFalse($router->getRouteByName('first'));
+		$this->assertEquals($first, $router->getRouteByName('renamed'));
+
+		// The first route with a name wins
+		$router->add('/third')->setName('second');
+		$this->assertEquals($second, $router->getRouteByName('second'));
+
+		$group = new Phalcon\Mvc\Router\Group();
+		$mounted = $group->add('/mounted')->setName('mounted');
+		$router->mount($group);
+		$this->assertEquals($mounted, $router->getRouteByName('mounted'));
+
+		$router->clear();
+		$this->assertFalse($router->getRouteByName('mounted'));
+	}
+
+	public function testReversedTemplate()
+	{
+		$route = new Phalcon\Mvc\Router\Route('/admin/:controller/p/:action', array(
+			'controller' => 1,
+			'action' => 2
+		));
+
+		$this->assertEquals($route->getReversedTemplate(), array('admin/', array('controller'), '/p/', array('action')));
+
+		$route = new Phalcon\Mvc\Router\Route('/wiki/{article:[a-z]+}/{page}');
+		$this->assertEquals($route->getReversedTemplate(), array('wiki/', array('article'), '/', array('page')));
+
+		$route->reConfigure('/about');
+		$this->assertEquals($route->getReversedTemplate(), array('about'));
+	}
+
 	public function testExtraSlashes()
 	{
 
@@ -180,6 +180,37 @@ class SessionTest extends PHPUnit_Framework_TestCase
 
 	}
 
+	public function testSessionFilesLazyStart()
+	{
+		if (headers_sent()) {
+			$this->markTestSkipped('The session cannot be started after the headers were sent');
+		}
+
+		$session_path =  __DIR__ . '/cache';
+		ini_set('session.save_handler', 'files');
+		ini_set('session.save_path', $session_path);
+		ini_set('session.serialize_handler', 'php');
+
+		$session = new Phalcon\Session\Adapter\Files(array('lazyStart' => true));
+
+		// The session is only opened when it's used
+		$this->assertTrue($session->start());
+		$this->assertTrue($session->isStarted());
+		$this->assertNotEquals($session::SESSION_ACTIVE, $session->status());
+		$this->assertFalse($session->start());
+
+		$session->set('some', 'lazy-value');
+
+		$this->assertEquals($session::SESSION_ACTIVE, $session->status());
+		$this->assertEquals($session->get('some'), 'lazy-value');
+
+		$session_id = $session->getId();
+		$this->assertNotEmpty($session_id);
+
+		$session->destroy();
+		@unlink($session_path . '/sess_' . $session_id);
+	}
+
     public function testSessionName()
     {
         $session = new Phalcon\Session\Adapter\Files();
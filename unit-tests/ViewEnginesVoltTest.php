@@ -1216,6 +1216,51 @@ Clearly, the song is: <?php echo $this->getContent(); ?>.
 
 	}
 
+	public function testVoltCompileAllManifest()
+	{
+		@unlink('unit-tests/cache/volt-manifest.php');
+
+		$options = array('manifest' => 'unit-tests/cache/volt-manifest.php', 'manifestVersion' => '1.0.0');
+
+		$volt = new Compiler();
+		$volt->setOptions($options);
+
+		$compiled = $volt->compileAll('unit-tests/views/templates');
+		sort($compiled);
+		$this->assertEquals($compiled, array('unit-tests/views/templates/a.volt', 'unit-tests/views/templates/b.volt', 'unit-tests/views/templates/c.volt'));
+		$this->assertTrue(file_exists('unit-tests/cache/volt-manifest.php'));
+
+		$manifest = require 'unit-tests/cache/volt-manifest.php';
+		$this->assertEquals($manifest['version'], '1.0.0');
+		$this->assertEquals($manifest['templates']['unit-tests/views/templates/c.volt'], array('unit-tests/views/templates/c.volt.php', null));
+		$this->assertEquals($manifest['templates']['unit-tests/views/templates/b.volt%%e'][0], 'unit-tests/views/templates/b.volt%%e%%.php');
+		$this->assertTrue(is_array($manifest['templates']['unit-tests/views/templates/b.volt%%e'][1]));
+
+		//Templates in the manifest are resolved without being checked
+		$manifest['templates']['unit-tests/views/templates/missing.volt'] = array('unit-tests/views/templates/c.volt.php', null);
+		file_put_contents('unit-tests/cache/volt-manifest.php', '<?php return ' . var_export($manifest, true) . ';');
+
+		$volt = new Compiler();
+		$volt->setOptions(array('manifest' => 'unit-tests/cache/volt-manifest.php', 'manifestVersion' => '1.0.1'));
+		$this->assertEquals($volt->getManifest(), array('version' => '1.0.1', 'templates' => array()));
+
+		$volt->setOptions($options);
+		$manifest = $volt->getManifest();
+		$this->assertTrue(isset($manifest['templates']['unit-tests/views/templates/missing.volt']));
+		$volt->setOptions(array('manifest' => 'unit-tests/cache/volt-manifest.php', 'manifestVersion' => '1.0.0', 'stat' => false));
+		$volt->compile('unit-tests/views/templates/missing.volt');
+		$this->assertEquals($volt->getCompiledTemplatePath(), 'unit-tests/views/templates/c.volt.php');
+
+		//Templates that don't exist anymore are dropped when the manifest is rebuilt
+		$volt->setOptions($options);
+		$volt->compileAll('unit-tests/views/templates');
+		$manifest = require 'unit-tests/cache/volt-manifest.php';
+		$this->assertFalse(isset($manifest['templates']['unit-tests/views/templates/missing.volt']));
+		$this->assertTrue(isset($manifest['templates']['unit-tests/views/templates/c.volt']));
+
+		@unlink('unit-tests/cache/volt-manifest.php');
+	}
+
 	public function testVoltCompilerExtendsFile()
 	{
 
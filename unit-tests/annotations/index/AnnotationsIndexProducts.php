@@ -0,0 +1,25 @@
+<?php
+
+/**
+ * @RoutePrefix("/products")
+ */
+class AnnotationsIndexProducts
+{
+
+	/**
+	 * @Get("/")
+	 */
+	public function indexAction()
+	{
+
+	}
+
+	/**
+	 * @Get("/edit/{id:[0-9]+}")
+	 * @Post("/edit/{id:[0-9]+}")
+	 */
+	public function editAction($id)
+	{
+
+	}
+}
@@ -0,0 +1,21 @@
+<?php
+
+/**
+ * @RoutePrefix("/robots")
+ */
+class AnnotationsIndexRobots
+{
+
+	/**
+	 * @Column(type="integer")
+	 */
+	public $id;
+
+	/**
+	 * @Get("/")
+	 */
+	public function indexAction()
+	{
+
+	}
+}